@@ -0,0 +1,665 @@
+/**
+ * Benchmarks of the hot paths of List, Queue and Stack against the standard
+ * containers.
+ *
+ * The library is header only and so is this file, it has no dependency besides the
+ * standard library:
+ *
+ *     g++ -std=c++20 -O2 -DNDEBUG -Iinclude bench/bench.cpp -o own-bench
+ *     ./own-bench [filter] [size...]
+ *
+ * or through the own-bench target of the top level CMakeLists.txt:
+ *
+ *     cmake -S . -B build && cmake --build build --target own-bench
+ *
+ * filter only runs the operations whose name contains it, sizes default to 1000
+ * and 100000 elements. Every row reports the time per element, the allocations
+ * per element and the peak of live heap bytes per element, counted by the global
+ * operator new and delete replaced below.
+ */
+
+#include "list.hpp"
+#include "queue.hpp"
+#include "ring_buffer.hpp"
+#include "stack.hpp"
+
+// std::reverse and std::find
+#include <algorithm>
+// std::chrono::steady_clock
+#include <chrono>
+// std::printf
+#include <cstdio>
+// std::malloc and std::free
+#include <cstdlib>
+// std::strstr
+#include <cstring>
+// std::deque
+#include <deque>
+// std::list
+#include <list>
+// std::bad_alloc
+#include <new>
+// std::accumulate
+#include <numeric>
+// std::queue
+#include <queue>
+// std::ostringstream and std::istringstream
+#include <sstream>
+// std::stack
+#include <stack>
+// std::string and std::to_string
+#include <string>
+// std::is_arithmetic
+#include <type_traits>
+// std::vector
+#include <vector>
+
+namespace bench {
+
+    /**
+     * @brief What the replaced operator new has seen since the last reset.
+     */
+    struct Counters {
+        own::usize allocs;
+        own::usize live;
+        own::usize peak;
+    };
+
+    Counters counters = {0, 0, 0};
+
+    /**
+     * @brief Every block is prefixed by its size, so delete knows what is released.
+     */
+    const own::usize PREFIX = alignof(std::max_align_t);
+
+    void* allocate(own::usize size) {
+        unsigned char* block = static_cast<unsigned char*>(std::malloc(size + PREFIX));
+        if (block == NULL) {
+            throw std::bad_alloc();
+        }
+
+        *reinterpret_cast<own::usize*>(block) = size;
+        counters.allocs++;
+        counters.live += size;
+        if (counters.live > counters.peak) {
+            counters.peak = counters.live;
+        }
+
+        return block + PREFIX;
+    }
+
+    void release(void* ptr) {
+        if (ptr == NULL) {
+            return;
+        }
+
+        unsigned char* block = static_cast<unsigned char*>(ptr) - PREFIX;
+        counters.live -= *reinterpret_cast<own::usize*>(block);
+        std::free(block);
+    }
+
+} // namespace bench
+
+void* operator new(std::size_t size) { return bench::allocate(size); }
+void* operator new[](std::size_t size) { return bench::allocate(size); }
+void operator delete(void* ptr) noexcept { bench::release(ptr); }
+void operator delete[](void* ptr) noexcept { bench::release(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { bench::release(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { bench::release(ptr); }
+
+namespace bench {
+
+    /**
+     * @brief Runs are repeated until they add up to this much time.
+     */
+    const double MIN_TOTAL_MS = 50.0;
+
+    /**
+     * @brief Only the operations whose name contains it are run, NULL runs all.
+     */
+    const char* filter = NULL;
+
+    /**
+     * @brief Keeps the compiler from dropping a result nobody reads.
+     */
+    template <typename T>
+    inline void keep(const T& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief The i-th element of type T, spread so that lookups have to compare.
+     */
+    template <typename T>
+    T make(own::usize i);
+
+    template <>
+    int make<int>(own::usize i) {
+        return int(i * 2654435761u % 1000003u);
+    }
+
+    template <>
+    std::string make<std::string>(own::usize i) {
+        // longer than the small string buffer, so every element owns a block
+        return "element-number-" + std::to_string(i * 2654435761u % 1000003u);
+    }
+
+    template <typename T>
+    const char* typeName();
+
+    template <>
+    const char* typeName<int>() {
+        return "int";
+    }
+
+    template <>
+    const char* typeName<std::string>() {
+        return "string";
+    }
+
+    template <typename T>
+    std::vector<T> values(own::usize n) {
+        std::vector<T> values;
+        values.reserve(n);
+        for (own::usize i = 0; i < n; i++) {
+            values.push_back(make<T>(i));
+        }
+
+        return values;
+    }
+
+    /**
+     * @brief Positions in [0, bound) from a fixed seed, the same for every
+     * implementation.
+     */
+    std::vector<own::usize> positions(own::usize count, own::usize bound) {
+        std::vector<own::usize> positions;
+        positions.reserve(count);
+
+        own::usize state = 88172645463325252ull;
+        for (own::usize i = 0; i < count; i++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            positions.push_back(state % (bound + i + 1));
+        }
+
+        return positions;
+    }
+
+    inline bool selected(const char* op) {
+        return filter == NULL || std::strstr(op, filter) != NULL;
+    }
+
+    void header() {
+        std::printf("%-14s %-22s %-7s %9s %12s %12s %14s\n", "operation", "container",
+                    "type", "n", "ns/elem", "allocs/elem", "peak B/elem");
+    }
+
+    /**
+     * @brief Times run on a fresh state from setup, only run is measured.
+     *
+     * @param op The name of the operation.
+     * @param impl The name of the container.
+     * @param n The amount of elements the row is normalized by.
+     * @param setup Returns the state run works on, its cost isn't counted.
+     * @param run Takes the state by reference.
+     */
+    template <typename T, typename Setup, typename Run>
+    void measure(const char* op, const char* impl, own::usize n, Setup setup, Run run) {
+        double totalMs = 0;
+        own::usize reps = 0;
+        own::usize allocs = 0;
+        own::usize peak = 0;
+
+        while (totalMs < MIN_TOTAL_MS || reps == 0) {
+            auto state = setup();
+
+            own::usize baseAllocs = counters.allocs;
+            counters.peak = counters.live;
+            own::usize baseLive = counters.live;
+
+            auto start = std::chrono::steady_clock::now();
+            run(state);
+            auto stop = std::chrono::steady_clock::now();
+
+            allocs += counters.allocs - baseAllocs;
+            if (counters.peak - baseLive > peak) {
+                peak = counters.peak - baseLive;
+            }
+
+            totalMs += std::chrono::duration<double, std::milli>(stop - start).count();
+            reps++;
+        }
+
+        double perElem = n > 0 ? double(n) : 1.0;
+        std::printf("%-14s %-22s %-7s %9zu %12.2f %12.2f %14.1f\n", op, impl,
+                    typeName<T>(), n, totalMs * 1e6 / double(reps) / perElem,
+                    double(allocs) / double(reps) / perElem, double(peak) / perElem);
+    }
+
+    /**
+     * @brief A state without anything to prepare.
+     */
+    inline int nothing() { return 0; }
+
+    template <typename T>
+    void queueOps(const std::vector<T>& input) {
+        if (!selected("push/popFront")) {
+            return;
+        }
+
+        own::usize n = input.size();
+        const char* op = "push/popFront";
+
+        measure<T>(op, "own::List", n, nothing, [&](int&) {
+            own::List<T> list;
+            for (const T& value : input) {
+                list.pushBack(value);
+            }
+            while (!list.empty()) {
+                keep(list.popFront());
+            }
+        });
+        measure<T>(op, "own::Queue<List>", n, nothing, [&](int&) {
+            own::Queue<T> queue;
+            for (const T& value : input) {
+                queue.push(value);
+            }
+            while (!queue.empty()) {
+                keep(queue.pop());
+            }
+        });
+        measure<T>(op, "own::Queue<RingBuffer>", n, nothing, [&](int&) {
+            own::Queue<T, own::RingBuffer<T> > queue;
+            for (const T& value : input) {
+                queue.push(value);
+            }
+            while (!queue.empty()) {
+                keep(queue.pop());
+            }
+        });
+        measure<T>(op, "own::Queue batch", n, nothing, [&](int&) {
+            own::Queue<T> queue;
+            queue.pushBatch(input.begin(), input.end());
+
+            std::vector<T> out;
+            out.reserve(input.size());
+            queue.popBatch(std::back_inserter(out), input.size());
+            keep(out.size());
+        });
+        measure<T>(op, "std::list", n, nothing, [&](int&) {
+            std::list<T> list;
+            for (const T& value : input) {
+                list.push_back(value);
+            }
+            while (!list.empty()) {
+                keep(list.front());
+                list.pop_front();
+            }
+        });
+        measure<T>(op, "std::deque", n, nothing, [&](int&) {
+            std::deque<T> deque;
+            for (const T& value : input) {
+                deque.push_back(value);
+            }
+            while (!deque.empty()) {
+                keep(deque.front());
+                deque.pop_front();
+            }
+        });
+        measure<T>(op, "std::queue", n, nothing, [&](int&) {
+            std::queue<T> queue;
+            for (const T& value : input) {
+                queue.push(value);
+            }
+            while (!queue.empty()) {
+                keep(queue.front());
+                queue.pop();
+            }
+        });
+    }
+
+    template <typename T>
+    void stackOps(const std::vector<T>& input) {
+        if (!selected("push/popBack")) {
+            return;
+        }
+
+        own::usize n = input.size();
+        const char* op = "push/popBack";
+
+        measure<T>(op, "own::Stack<Vector>", n, nothing, [&](int&) {
+            own::Stack<T> stack;
+            for (const T& value : input) {
+                stack.push(value);
+            }
+            while (!stack.empty()) {
+                keep(stack.pop());
+            }
+        });
+        measure<T>(op, "own::Stack<List>", n, nothing, [&](int&) {
+            own::Stack<T, own::List<T> > stack;
+            for (const T& value : input) {
+                stack.push(value);
+            }
+            while (!stack.empty()) {
+                keep(stack.pop());
+            }
+        });
+        measure<T>(op, "std::stack", n, nothing, [&](int&) {
+            std::stack<T> stack;
+            for (const T& value : input) {
+                stack.push(value);
+            }
+            while (!stack.empty()) {
+                keep(stack.top());
+                stack.pop();
+            }
+        });
+        measure<T>(op, "std::vector", n, nothing, [&](int&) {
+            std::vector<T> vector;
+            for (const T& value : input) {
+                vector.push_back(value);
+            }
+            while (!vector.empty()) {
+                keep(vector.back());
+                vector.pop_back();
+            }
+        });
+    }
+
+    template <typename T>
+    void insertOps(const std::vector<T>& input) {
+        if (!selected("insertForward")) {
+            return;
+        }
+
+        // inserting is quadratic for every container, a fixed count keeps it short
+        own::usize count = input.size() < 1000 ? input.size() : 1000;
+        std::vector<own::usize> at = positions(count, input.size());
+        T value = make<T>(input.size());
+        const char* op = "insertForward";
+
+        measure<T>(op, "own::List", count,
+                   [&]() { return own::List<T>(input.begin(), input.end()); },
+                   [&](own::List<T>& list) {
+                       for (own::usize pos : at) {
+                           list.insertForward(value, pos);
+                       }
+                   });
+        measure<T>(op, "std::list", count,
+                   [&]() { return std::list<T>(input.begin(), input.end()); },
+                   [&](std::list<T>& list) {
+                       for (own::usize pos : at) {
+                           auto it = list.begin();
+                           std::advance(it, pos < list.size() ? pos : list.size());
+                           list.insert(it, value);
+                       }
+                   });
+        measure<T>(op, "std::vector", count, [&]() { return input; },
+                   [&](std::vector<T>& vector) {
+                       for (own::usize pos : at) {
+                           own::usize bounded = pos < vector.size() ? pos : vector.size();
+                           vector.insert(vector.begin() + bounded, value);
+                       }
+                   });
+    }
+
+    template <typename T>
+    void findOps(const std::vector<T>& input) {
+        own::usize n = input.size();
+        // absent, so every lookup walks the whole container
+        T missing = make<T>(n + 7);
+        T present = input[n / 2];
+
+        own::List<T> list(input.begin(), input.end());
+        std::list<T> stdList(input.begin(), input.end());
+
+        if (selected("find")) {
+            measure<T>("find", "own::List", n, nothing,
+                       [&](int&) { keep(list.find(missing)); });
+            measure<T>("find", "std::list", n, nothing, [&](int&) {
+                keep(std::find(stdList.begin(), stdList.end(), missing) == stdList.end());
+            });
+            measure<T>("find", "std::vector", n, nothing, [&](int&) {
+                keep(std::find(input.begin(), input.end(), missing) == input.end());
+            });
+        }
+
+        if (selected("findAll")) {
+            measure<T>("findAll", "own::List", n, nothing,
+                       [&](int&) { keep(list.findAll(present).len()); });
+            measure<T>("findAll", "std::vector", n, nothing, [&](int&) {
+                std::vector<own::usize> found;
+                for (own::usize i = 0; i < input.size(); i++) {
+                    if (input[i] == present) {
+                        found.push_back(i);
+                    }
+                }
+                keep(found.size());
+            });
+        }
+    }
+
+    /**
+     * @brief What the traversals add up, the value itself or the length of it.
+     */
+    inline own::usize weight(int value) { return own::usize(value); }
+    inline own::usize weight(const std::string& value) { return value.size(); }
+
+    template <typename T>
+    void traversalOps(const std::vector<T>& input) {
+        own::usize n = input.size();
+        own::List<T> list(input.begin(), input.end());
+        std::list<T> stdList(input.begin(), input.end());
+
+        auto add = [](own::usize sum, const T& value) { return sum + weight(value); };
+
+        if (selected("forEach")) {
+            measure<T>("forEach", "own::List", n, nothing, [&](int&) {
+                own::usize sum = 0;
+                list.forEach([&sum](const T& value) { sum += weight(value); });
+                keep(sum);
+            });
+            measure<T>("forEach", "std::list", n, nothing, [&](int&) {
+                keep(std::accumulate(stdList.begin(), stdList.end(), own::usize(0), add));
+            });
+            measure<T>("forEach", "std::vector", n, nothing, [&](int&) {
+                keep(std::accumulate(input.begin(), input.end(), own::usize(0), add));
+            });
+        }
+
+        if (selected("fold")) {
+            measure<T>("fold", "own::List", n, nothing, [&](int&) {
+                auto step = [](const T& value, own::usize& sum) { sum += weight(value); };
+                keep(list.fold(step, own::usize(0)));
+            });
+        }
+
+        if (selected("window")) {
+            measure<T>("window<8>", "own::List", n, nothing, [&](int&) {
+                own::List<own::usize> sums = list.template window<8>([](const T* values) {
+                    own::usize sum = 0;
+                    for (own::usize i = 0; i < 8; i++) {
+                        sum += weight(values[i]);
+                    }
+                    return sum;
+                });
+                keep(sums.len());
+            });
+            measure<T>("window<8>", "std::deque", n, nothing, [&](int&) {
+                std::deque<T> window;
+                std::vector<own::usize> sums;
+                for (const T& value : stdList) {
+                    window.push_back(value);
+                    if (window.size() > 8) {
+                        window.pop_front();
+                    }
+                    if (window.size() == 8) {
+                        sums.push_back(std::accumulate(window.begin(), window.end(),
+                                                       own::usize(0), add));
+                    }
+                }
+                keep(sums.size());
+            });
+        }
+    }
+
+    template <typename T>
+    void reshapeOps(const std::vector<T>& input) {
+        own::usize n = input.size();
+
+        if (selected("reverse")) {
+            measure<T>("reverse", "own::List", n,
+                       [&]() { return own::List<T>(input.begin(), input.end()); },
+                       [](own::List<T>& list) { list.reverse(); });
+            measure<T>("reverse", "std::list", n,
+                       [&]() { return std::list<T>(input.begin(), input.end()); },
+                       [](std::list<T>& list) { list.reverse(); });
+            measure<T>("reverse", "std::vector", n, [&]() { return input; },
+                       [](std::vector<T>& vector) {
+                           std::reverse(vector.begin(), vector.end());
+                       });
+        }
+
+        if (selected("sliceOff")) {
+            measure<T>("sliceOff", "own::List", n,
+                       [&]() { return own::List<T>(input.begin(), input.end()); },
+                       [n](own::List<T>& list) {
+                           keep(list.sliceOff(n / 4, n / 4 * 3).len());
+                       });
+            measure<T>("sliceOff", "std::list", n,
+                       [&]() { return std::list<T>(input.begin(), input.end()); },
+                       [n](std::list<T>& list) {
+                           auto first = std::next(list.begin(), n / 4);
+                           auto last = std::next(first, n / 4 * 3 - n / 4);
+
+                           std::list<T> slice;
+                           slice.splice(slice.begin(), list, first, last);
+                           keep(slice.size());
+                       });
+        }
+
+        if (selected("operator+")) {
+            own::List<T> list(input.begin(), input.end());
+            std::list<T> stdList(input.begin(), input.end());
+
+            measure<T>("operator+", "own::List", n, nothing,
+                       [&](int&) { keep((list + list).len()); });
+            measure<T>("operator+", "std::list", n, nothing, [&](int&) {
+                std::list<T> joined(stdList);
+                joined.insert(joined.end(), stdList.begin(), stdList.end());
+                keep(joined.size());
+            });
+            measure<T>("operator+", "std::vector", n, nothing, [&](int&) {
+                std::vector<T> joined;
+                joined.reserve(input.size() * 2);
+                joined.insert(joined.end(), input.begin(), input.end());
+                joined.insert(joined.end(), input.begin(), input.end());
+                keep(joined.size());
+            });
+        }
+    }
+
+    template <typename T>
+    void streamOps(const std::vector<T>& input) {
+        // strings have no delimiters in the text form, only numbers round trip
+        if constexpr (std::is_arithmetic<T>::value) {
+            own::usize n = input.size();
+            own::List<T> list(input.begin(), input.end());
+
+            std::ostringstream printed;
+            printed << list;
+            std::string text = printed.str();
+
+            if (selected("operator<<")) {
+                measure<T>("operator<<", "own::List", n, nothing, [&](int&) {
+                    std::ostringstream out;
+                    out << list;
+                    keep(out.tellp());
+                });
+                measure<T>("operator<<", "std::vector loop", n, nothing, [&](int&) {
+                    std::ostringstream out;
+                    out << '[';
+                    for (own::usize i = 0; i < input.size(); i++) {
+                        if (i > 0) {
+                            out << ", ";
+                        }
+                        out << input[i];
+                    }
+                    out << ']';
+                    keep(out.tellp());
+                });
+            }
+
+            if (selected("operator>>")) {
+                measure<T>("operator>>", "own::List", n, nothing, [&](int&) {
+                    std::istringstream in(text);
+                    own::List<T> read;
+                    in >> read;
+                    keep(read.len());
+                });
+                measure<T>("operator>>", "std::vector loop", n, nothing, [&](int&) {
+                    std::istringstream in(text);
+                    std::vector<T> read;
+                    char ch;
+                    T value;
+
+                    in >> ch;
+                    while (in >> value) {
+                        read.push_back(value);
+                        in >> ch;
+                    }
+                    keep(read.size());
+                });
+            }
+        }
+    }
+
+    template <typename T>
+    void suite(own::usize n) {
+        std::vector<T> input = values<T>(n);
+
+        queueOps(input);
+        stackOps(input);
+        insertOps(input);
+        findOps(input);
+        traversalOps(input);
+        reshapeOps(input);
+        streamOps(input);
+    }
+
+} // namespace bench
+
+int main(int argc, char** argv) {
+    std::vector<own::usize> sizes;
+
+    for (int i = 1; i < argc; i++) {
+        char* end = NULL;
+        unsigned long long size = std::strtoull(argv[i], &end, 10);
+
+        if (end != argv[i] && *end == '\0') {
+            sizes.push_back(own::usize(size));
+        } else {
+            bench::filter = argv[i];
+        }
+    }
+
+    if (sizes.empty()) {
+        sizes.push_back(1000);
+        sizes.push_back(100000);
+    }
+
+    bench::header();
+    for (own::usize n : sizes) {
+        if (n == 0) {
+            continue;
+        }
+
+        bench::suite<int>(n);
+        bench::suite<std::string>(n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,380 @@
+#ifndef BOUNDED_QUEUE_GUARD_HEADER
+#define BOUNDED_QUEUE_GUARD_HEADER
+
+#include "queue.hpp"
+#include "ring_buffer.hpp"
+
+// std::chrono::duration
+#include <chrono>
+// std::condition_variable
+#include <condition_variable>
+// std::mutex and std::unique_lock
+#include <mutex>
+// std::move
+#include <utility>
+
+namespace own {
+
+    /**
+     * @brief A Queue shared by threads that holds at most a fixed amount of
+     * elements, producers wait while it's full and consumers while it's empty.
+     *
+     * Every operation takes a mutex, waits sleep on condition variables and are
+     * woken once per batch rather than once per element, so producers and
+     * consumers moving many elements at a time pay one wakeup.
+     *
+     * Once closed, pushes fail and pops drain what's left before failing, which
+     * is how consumers learn there's nothing more to come.
+     *
+     * Usage:
+     *
+     *     own::BoundedQueue<Job> jobs(1024);
+     *
+     *     // producer
+     *     jobs.push(job);
+     *     jobs.close();
+     *
+     *     // consumer
+     *     Job job;
+     *     while (jobs.pop(job)) {
+     *         run(job);
+     *     }
+     *
+     * @tparam T The type of the value stored in the queue.
+     * @tparam Container The container of the underlying Queue, RingBuffer<T> by
+     * default so the memory is reserved once for the whole capacity.
+     */
+    template <typename T, typename Container = RingBuffer<T> >
+    class BoundedQueue {
+      public:
+        /**
+         * @brief Constructs an empty, open queue.
+         *
+         * Complexity: O(1), plus reserving the capacity if the container can
+         *
+         * @param capacity The maximum amount of elements, at least 1.
+         */
+        explicit BoundedQueue(usize capacity)
+            : queue(reserved(capacity > 0 ? capacity : 1)),
+              _capacity(capacity > 0 ? capacity : 1), closed(false) {}
+
+        /**
+         * @brief Returns the maximum amount of elements.
+         *
+         * Complexity: O(1)
+         */
+        inline usize capacity() const { return this->_capacity; }
+
+        /**
+         * @brief Returns the amount of elements, it may be outdated as soon as it
+         * returns.
+         *
+         * Complexity: O(1)
+         */
+        usize len() const {
+            std::lock_guard<std::mutex> guard(this->lock);
+            return this->queue.len();
+        }
+
+        /**
+         * @brief Checks if the queue is empty, it may be outdated as soon as it
+         * returns.
+         *
+         * Complexity: O(1)
+         */
+        inline bool empty() const { return this->len() == 0; }
+
+        /**
+         * @brief Checks if the queue was closed.
+         *
+         * Complexity: O(1)
+         */
+        bool isClosed() const {
+            std::lock_guard<std::mutex> guard(this->lock);
+            return this->closed;
+        }
+
+        /**
+         * @brief Closes the queue and wakes every waiting thread up.
+         *
+         * Complexity: O(1)
+         */
+        void close() {
+            {
+                std::lock_guard<std::mutex> guard(this->lock);
+                this->closed = true;
+            }
+
+            this->notEmpty.notify_all();
+            this->notFull.notify_all();
+        }
+
+        /**
+         * @brief Adds an element, waiting while the queue is full.
+         *
+         * Complexity: O(1), plus the wait
+         *
+         * @param value The value to be added, it's moved in only on success.
+         * @return False if the queue is or gets closed, true otherwise.
+         */
+        bool push(T value) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->notFull.wait(guard, [this]() { return this->hasRoom(); });
+
+            return this->add(guard, value);
+        }
+
+        /**
+         * @brief Adds an element only if there's room right now.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added, it's moved in only on success.
+         * @return False if the queue is full or closed, true otherwise.
+         */
+        bool tryPush(T value) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            return this->add(guard, value);
+        }
+
+        /**
+         * @brief Adds an element, waiting at most timeout while the queue is full.
+         *
+         * Complexity: O(1), plus the wait
+         *
+         * @param value The value to be added, it's moved in only on success.
+         * @param timeout The longest wait.
+         * @return False if the queue is still full or closed, true otherwise.
+         */
+        template <typename Rep, typename Period>
+        bool pushFor(T value, const std::chrono::duration<Rep, Period>& timeout) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->notFull.wait_for(guard, timeout, [this]() { return this->hasRoom(); });
+
+            return this->add(guard, value);
+        }
+
+        /**
+         * @brief Adds a copy of the elements from first to last, waiting for room as
+         * many times as needed. Consumers are woken once for every run of elements
+         * that fit.
+         *
+         * Complexity: O(m), plus the waits
+         *
+         * @param first The first element to be added.
+         * @param last Past the last element to be added.
+         * @return Where it stopped, last unless the queue got closed.
+         */
+        template <typename Iterator>
+        Iterator pushBatch(Iterator first, Iterator last) {
+            std::unique_lock<std::mutex> guard(this->lock);
+
+            while (first != last) {
+                this->notFull.wait(guard, [this]() { return this->hasRoom(); });
+                if (this->closed) {
+                    break;
+                }
+
+                usize added = 0;
+                for (; first != last && this->queue.len() < this->_capacity; ++first) {
+                    this->queue.push(*first);
+                    added++;
+                }
+
+                this->wake(guard, this->notEmpty, added);
+                guard.lock();
+            }
+
+            return first;
+        }
+
+        /**
+         * @brief Removes the first element, waiting while the queue is empty.
+         *
+         * Complexity: O(1), plus the wait
+         *
+         * @param out Where the value is moved.
+         * @return False if the queue is closed and empty, true otherwise.
+         */
+        bool pop(T& out) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->notEmpty.wait(guard, [this]() { return this->hasElements(); });
+
+            return this->take(guard, out);
+        }
+
+        /**
+         * @brief Removes the first element only if there's one right now.
+         *
+         * Complexity: O(1)
+         *
+         * @param out Where the value is moved.
+         * @return False if the queue is empty, true otherwise.
+         */
+        bool tryPop(T& out) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            return this->take(guard, out);
+        }
+
+        /**
+         * @brief Removes the first element, waiting at most timeout while the queue
+         * is empty.
+         *
+         * Complexity: O(1), plus the wait
+         *
+         * @param out Where the value is moved.
+         * @param timeout The longest wait.
+         * @return False if the queue is still empty, true otherwise.
+         */
+        template <typename Rep, typename Period>
+        bool popFor(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->notEmpty.wait_for(guard, timeout,
+                                    [this]() { return this->hasElements(); });
+
+            return this->take(guard, out);
+        }
+
+        /**
+         * @brief Removes up to n elements once there's at least one, moving them to
+         * out in order. Producers are woken once for all of them.
+         *
+         * Complexity: O(m), where m is the amount removed, plus the wait
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value, nothing is written if the queue
+         * is closed and empty.
+         */
+        template <typename Output>
+        Output popBatch(Output out, usize n) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->notEmpty.wait(guard, [this]() { return this->hasElements(); });
+
+            return this->takeBatch(guard, out, n);
+        }
+
+        /**
+         * @brief Removes up to n elements, waiting at most timeout for the first one.
+         *
+         * Complexity: O(m), where m is the amount removed, plus the wait
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @param timeout The longest wait.
+         * @return out past the last written value.
+         */
+        template <typename Output, typename Rep, typename Period>
+        Output popBatchFor(Output out, usize n,
+                           const std::chrono::duration<Rep, Period>& timeout) {
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->notEmpty.wait_for(guard, timeout,
+                                    [this]() { return this->hasElements(); });
+
+            return this->takeBatch(guard, out, n);
+        }
+
+      private:
+        /**
+         * @brief Returns an empty container with room for capacity elements, if it
+         * can reserve.
+         */
+        static Container reserved(usize capacity) {
+            Container container;
+            if constexpr (details::HasReserve<Container>::value) {
+                container.reserve(capacity);
+            }
+
+            return container;
+        }
+
+        inline bool hasRoom() const {
+            return this->closed || this->queue.len() < this->_capacity;
+        }
+
+        inline bool hasElements() const { return this->closed || !this->queue.empty(); }
+
+        /**
+         * @brief Unlocks and wakes up to count waiters of a condition, notifying
+         * after unlocking so they don't wake up only to block on the mutex.
+         */
+        void wake(std::unique_lock<std::mutex>& guard, std::condition_variable& waiters,
+                  usize count) {
+            guard.unlock();
+
+            if (count == 1) {
+                waiters.notify_one();
+            } else if (count > 1) {
+                waiters.notify_all();
+            }
+        }
+
+        /**
+         * @brief Pushes value if there's room and the queue is open, the lock is
+         * released.
+         */
+        bool add(std::unique_lock<std::mutex>& guard, T& value) {
+            if (this->closed || this->queue.len() >= this->_capacity) {
+                return false;
+            }
+
+            this->queue.push(std::move(value));
+            this->wake(guard, this->notEmpty, 1);
+            return true;
+        }
+
+        /**
+         * @brief Pops into out if there's an element, the lock is released.
+         */
+        bool take(std::unique_lock<std::mutex>& guard, T& out) {
+            if (this->queue.empty()) {
+                return false;
+            }
+
+            out = this->queue.pop();
+            this->wake(guard, this->notFull, 1);
+            return true;
+        }
+
+        /**
+         * @brief Pops up to n elements into out, the lock is released.
+         */
+        template <typename Output>
+        Output takeBatch(std::unique_lock<std::mutex>& guard, Output out, usize n) {
+            usize before = this->queue.len();
+            out = this->queue.popBatch(out, n);
+
+            this->wake(guard, this->notFull, before - this->queue.len());
+            return out;
+        }
+
+      private:
+        /**
+         * @brief The elements, guarded by lock.
+         */
+        Queue<T, Container> queue;
+        /**
+         * @brief The maximum amount of elements.
+         */
+        const usize _capacity;
+        /**
+         * @brief Set by close, guarded by lock.
+         */
+        bool closed;
+        /**
+         * @brief Guards queue and closed.
+         */
+        mutable std::mutex lock;
+        /**
+         * @brief Where consumers wait for elements.
+         */
+        std::condition_variable notEmpty;
+        /**
+         * @brief Where producers wait for room.
+         */
+        std::condition_variable notFull;
+    };
+
+} // namespace own
+
+#endif // BOUNDED_QUEUE_GUARD_HEADER
@@ -0,0 +1,572 @@
+#ifndef CORE_GUARD_HEADER
+#define CORE_GUARD_HEADER
+
+// std::usize and NULL
+#include <cstddef>
+// std::ostream operator<< overloading
+#include <ostream>
+// std::istream operator>> overloading
+#include <istream>
+// std::memcpy
+#include <cstring>
+// std::is_trivially_copyable, std::enable_if and std::is_convertible
+#include <type_traits>
+// std::move_if_noexcept
+#include <utility>
+// placement new
+#include <new>
+// std::random_access_iterator_tag, std::forward_iterator_tag and
+// std::iterator_traits
+#include <iterator>
+// std::sort and std::lower_bound
+#include <algorithm>
+// std::hash
+#include <functional>
+// std::uint64_t
+#include <cstdint>
+
+/**
+ * @brief The language standard being compiled, MSVC only reports the real one
+ * in _MSVC_LANG unless /Zc:__cplusplus is given.
+ */
+#if defined(_MSVC_LANG)
+#define OWN_CPLUSPLUS _MSVC_LANG
+#else
+#define OWN_CPLUSPLUS __cplusplus
+#endif
+
+// every header needs C++17, spsc_queue, thread_pool, parallel and static_list C++20
+static_assert(OWN_CPLUSPLUS >= 201703L, "own-stl requires C++17 or later");
+
+namespace own {
+
+    /**
+     * @brief Typedef for an unsigned integer representing size.
+     *
+     * This typedef is used to define an alias `usize` for `std::size_t`.
+     * It is commonly used to represent the size of objects or arrays.
+     */
+    typedef std::size_t usize;
+
+    /**
+     * @brief Typedef for a signed long integer representing size.
+     *
+     * This typedef is used to define an alias `isize` for `signed long`.
+     * It is commonly used to represent the size of objects or arrays, but in signed
+     * form.
+     */
+    typedef signed long isize;
+
+    /**
+     * @brief Constant representing the absence of a valid position.
+     *
+     * This constant `NO_POS` is defined with a value of -1.
+     * It is commonly used to indicate the absence of a valid position or index.
+     */
+    const usize NO_POS = -1;
+
+    /**
+     * @brief Size of a cache line, concurrent containers keep the data written by
+     * different threads this far apart to avoid false sharing.
+     */
+    const usize CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief How many values have to be looked up before membership queries
+     * between containers build a details::ValueSet, below it walking is cheaper.
+     */
+    const usize VALUE_SET_MIN_QUERIES = 8;
+
+    namespace details {
+
+        /**
+         * @brief Rounds up to the next power of two.
+         *
+         * Complexity: O(log n)
+         *
+         * @param value The value to be rounded.
+         * @return The smallest power of two greater or equal than value, 1 if value
+         * is 0.
+         */
+        inline usize nextPowerOfTwo(usize value) {
+            usize power = 1;
+            while (power < value) {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        /**
+         * @brief Tells the processor the thread is spinning on a shared variable, so
+         * it can save power and give resources to its sibling hyperthread.
+         *
+         * Complexity: O(1)
+         */
+        inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            __asm__ __volatile__("yield");
+#endif
+        }
+
+        /**
+         * @brief Moves len elements into uninitialized storage and destroys the
+         * originals.
+         *
+         * Trivially copyable elements are copied at once, otherwise they are moved
+         * one by one, unless their move may throw and they can be copied instead.
+         *
+         * Complexity: O(n)
+         *
+         * @param dest The uninitialized storage, it must not overlap src.
+         * @param src The elements to be relocated.
+         * @param len The amount of elements.
+         */
+        template <typename T>
+        void relocate(T* dest, T* src, usize len) {
+            if (len == 0) {
+                return;
+            }
+
+            if constexpr (std::is_trivially_copyable<T>::value) {
+                std::memcpy(static_cast<void*>(dest), src, sizeof(T) * len);
+            } else {
+                for (usize i = 0; i < len; i++) {
+                    new (dest + i) T(std::move_if_noexcept(src[i]));
+                    src[i].~T();
+                }
+            }
+        }
+
+        /**
+         * @brief A random access iterator over any container providing operator[].
+         *
+         * It only stores the container and the index, so the container is free to
+         * map indices to its storage, as ring buffers do.
+         *
+         * @tparam Container The container type, const for a const iterator.
+         * @tparam T The element type, const for a const iterator.
+         */
+        template <typename Container, typename T>
+        class IndexIterator {
+          public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef typename std::remove_const<T>::type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T* pointer;
+            typedef T& reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            IndexIterator() : container(NULL), at(0) {}
+
+            /**
+             * @brief Constructs an iterator pointing to an index of a container.
+             *
+             * Complexity: O(1)
+             *
+             * @param container The container being iterated.
+             * @param at The index of the element.
+             */
+            IndexIterator(Container* container, usize at)
+                : container(container), at(at) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename OtherContainer, typename U,
+                      typename = typename std::enable_if<
+                          std::is_convertible<OtherContainer*, Container*>::value &&
+                          std::is_convertible<U*, T*>::value>::type>
+            IndexIterator(const IndexIterator<OtherContainer, U>& other)
+                : container(other.container), at(other.at) {}
+
+            // Standard random access iterator operations, all of them O(1).
+
+            inline reference operator*() const { return (*this->container)[this->at]; }
+            inline pointer operator->() const { return &(*this->container)[this->at]; }
+            inline reference operator[](difference_type n) const {
+                return (*this->container)[this->at + n];
+            }
+
+            inline IndexIterator& operator++() {
+                this->at++;
+                return *this;
+            }
+            inline IndexIterator operator++(int) {
+                IndexIterator it = *this;
+                this->at++;
+                return it;
+            }
+            inline IndexIterator& operator--() {
+                this->at--;
+                return *this;
+            }
+            inline IndexIterator operator--(int) {
+                IndexIterator it = *this;
+                this->at--;
+                return it;
+            }
+
+            inline IndexIterator& operator+=(difference_type n) {
+                this->at += n;
+                return *this;
+            }
+            inline IndexIterator& operator-=(difference_type n) {
+                this->at -= n;
+                return *this;
+            }
+            inline IndexIterator operator+(difference_type n) const {
+                return IndexIterator(this->container, this->at + n);
+            }
+            inline IndexIterator operator-(difference_type n) const {
+                return IndexIterator(this->container, this->at - n);
+            }
+            friend inline difference_type operator-(const IndexIterator& a,
+                                                    const IndexIterator& b) {
+                return difference_type(a.at) - difference_type(b.at);
+            }
+            friend inline IndexIterator operator+(difference_type n,
+                                                  const IndexIterator& it) {
+                return it + n;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend inline bool operator==(const IndexIterator& a,
+                                          const IndexIterator& b) {
+                return a.at == b.at && a.container == b.container;
+            }
+            friend inline bool operator!=(const IndexIterator& a,
+                                          const IndexIterator& b) {
+                return !(a == b);
+            }
+            friend inline bool operator<(const IndexIterator& a, const IndexIterator& b) {
+                return a.at < b.at;
+            }
+            friend inline bool operator>(const IndexIterator& a, const IndexIterator& b) {
+                return a.at > b.at;
+            }
+            friend inline bool operator<=(const IndexIterator& a,
+                                          const IndexIterator& b) {
+                return a.at <= b.at;
+            }
+            friend inline bool operator>=(const IndexIterator& a,
+                                          const IndexIterator& b) {
+                return a.at >= b.at;
+            }
+
+          private:
+            template <typename, typename>
+            friend class IndexIterator;
+
+            /**
+             * @brief The container being iterated.
+             */
+            Container* container;
+            /**
+             * @brief The index of the element.
+             */
+            usize at;
+        };
+
+        /**
+         * @brief Checks if std::hash is enabled for T.
+         */
+        template <typename T, typename = void>
+        struct IsHashable : std::false_type {};
+
+        template <typename T>
+        struct IsHashable<
+            T, std::void_t<decltype(std::hash<T>()(std::declval<const T&>()))> >
+            : std::true_type {};
+
+        /**
+         * @brief Checks if T can be ordered with operator<.
+         */
+        template <typename T, typename = void>
+        struct IsLessComparable : std::false_type {};
+
+        template <typename T>
+        struct IsLessComparable<T, std::void_t<decltype(std::declval<const T&>() <
+                                                        std::declval<const T&>())> >
+            : std::true_type {};
+
+        /**
+         * @brief Checks if Iterator can walk a range more than once, so its length
+         * can be measured before the elements are read.
+         */
+        template <typename Iterator>
+        struct IsForwardIterator
+            : std::is_base_of<
+                  std::forward_iterator_tag,
+                  typename std::iterator_traits<Iterator>::iterator_category> {};
+
+        /**
+         * @brief Checks if a container can append a range of Iterator in one go.
+         */
+        template <typename Container, typename Iterator, typename = void>
+        struct HasPushBackN : std::false_type {};
+
+        template <typename Container, typename Iterator>
+        struct HasPushBackN<Container, Iterator,
+                            std::void_t<decltype(std::declval<Container&>().pushBackN(
+                                std::declval<Iterator>(), std::declval<Iterator>()))> >
+            : std::true_type {};
+
+        /**
+         * @brief Checks if a container can remove many front elements in one go.
+         */
+        template <typename Container, typename Output, typename = void>
+        struct HasPopFrontN : std::false_type {};
+
+        template <typename Container, typename Output>
+        struct HasPopFrontN<Container, Output,
+                            std::void_t<decltype(std::declval<Container&>().popFrontN(
+                                std::declval<Output>(), usize()))> > : std::true_type {};
+
+        /**
+         * @brief Checks if a container can remove many back elements in one go.
+         */
+        template <typename Container, typename Output, typename = void>
+        struct HasPopBackN : std::false_type {};
+
+        template <typename Container, typename Output>
+        struct HasPopBackN<Container, Output,
+                           std::void_t<decltype(std::declval<Container&>().popBackN(
+                               std::declval<Output>(), usize()))> > : std::true_type {};
+
+        /**
+         * @brief A read-only set of the values of a container, built once to answer
+         * many membership queries.
+         *
+         * Hashable values go into an open addressing table, otherwise they are
+         * sorted and binary searched. Only pointers are stored, so the container
+         * must outlive the set and stay untouched meanwhile.
+         *
+         * @tparam T The type of the values, see supported.
+         */
+        template <typename T>
+        class ValueSet {
+          public:
+            /**
+             * @brief True if values are hashed, false if they are sorted.
+             */
+            static const bool HASHED = IsHashable<T>::value;
+            /**
+             * @brief True if T is hashable or ordered, otherwise the set can't be
+             * built and callers have to walk the container.
+             */
+            static const bool supported = HASHED || IsLessComparable<T>::value;
+
+            /**
+             * @brief Builds the set from a range.
+             *
+             * Complexity: O(n), if T is hashable
+             * Complexity: O(n log n), otherwise
+             *
+             * @param first The first value.
+             * @param last Past the last value.
+             * @param len The amount of values in the range.
+             * @throws std::bad_alloc if the set cannot be allocated.
+             */
+            template <typename Iterator>
+            ValueSet(Iterator first, Iterator last, usize len) {
+                if constexpr (HASHED) {
+                    this->size = nextPowerOfTwo(len * 2 > 2 ? len * 2 : 2);
+                    this->shift = 64;
+                    for (usize size = this->size; size > 1; size >>= 1) {
+                        this->shift--;
+                    }
+
+                    this->slots = new const T*[this->size]();
+                    for (; first != last; ++first) {
+                        this->insert(&*first);
+                    }
+                } else {
+                    this->size = len;
+                    this->shift = 0;
+
+                    this->slots = new const T*[len > 0 ? len : 1];
+                    for (usize i = 0; first != last; ++first, ++i) {
+                        this->slots[i] = &*first;
+                    }
+                    std::sort(this->slots, this->slots + len,
+                              [](const T* a, const T* b) { return *a < *b; });
+                }
+            }
+
+            /**
+             * @brief Destructor.
+             *
+             * Complexity: O(1)
+             */
+            ~ValueSet() { delete[] this->slots; }
+
+            /**
+             * @brief Checks if a value is in the set.
+             *
+             * Complexity: O(1), expected, if T is hashable
+             * Complexity: O(log n), otherwise
+             *
+             * @param value The value to be checked.
+             * @return True if an equal value is in the set, false otherwise.
+             */
+            bool has(const T& value) const {
+                if constexpr (HASHED) {
+                    usize mask = this->size - 1;
+                    for (usize at = this->slot(value);; at = (at + 1) & mask) {
+                        if (this->slots[at] == NULL) {
+                            return false;
+                        }
+                        if (*this->slots[at] == value) {
+                            return true;
+                        }
+                    }
+                } else {
+                    const T* const* begin = this->slots;
+                    const T* const* end = begin + this->size;
+                    const T* const* it =
+                        std::lower_bound(begin, end, &value,
+                                         [](const T* a, const T* b) { return *a < *b; });
+
+                    return it != end && !(value < **it);
+                }
+            }
+
+          private:
+            /**
+             * @brief Returns the home slot of a value, the hash is mixed by Fibonacci
+             * hashing since std::hash is the identity for integers.
+             *
+             * Complexity: O(1)
+             */
+            inline usize slot(const T& value) const {
+                std::uint64_t hash = std::hash<T>()(value);
+                return usize((hash * 0x9E3779B97F4A7C15ull) >> this->shift) &
+                       (this->size - 1);
+            }
+
+            /**
+             * @brief Inserts a value, unless an equal one is already there.
+             *
+             * Complexity: O(1), expected
+             */
+            void insert(const T* value) {
+                usize at = this->slot(*value);
+                while (this->slots[at] != NULL) {
+                    if (*this->slots[at] == *value) {
+                        return;
+                    }
+                    at = (at + 1) & (this->size - 1);
+                }
+
+                this->slots[at] = value;
+            }
+
+            /**
+             * @brief Sets cannot be copied.
+             */
+            ValueSet(const ValueSet<T>&) = delete;
+            void operator=(const ValueSet<T>&) = delete;
+
+          private:
+            /**
+             * @brief The hash table, NULL marks a free slot, or the sorted values.
+             */
+            const T** slots;
+            /**
+             * @brief The amount of slots, a power of two if hashed.
+             */
+            usize size;
+            /**
+             * @brief 64 - log2(size), the hash bits that are kept.
+             */
+            unsigned shift;
+        };
+
+        /**
+         * @brief Writes an indexable container as `[a, b, c]`.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param container The container to be written, it must provide len() and
+         * operator[].
+         * @return The output stream.
+         */
+        template <typename Container>
+        std::ostream& writeSequence(std::ostream& out, const Container& container) {
+            out << '[';
+
+            for (usize i = 0; i < container.len(); i++) {
+                if (i > 0) {
+                    out << ", ";
+                }
+                out << container[i];
+            }
+
+            out << ']';
+            return out;
+        }
+
+        /**
+         * @brief Reads a sequence written as `[a, b, c]` pushing every value at the
+         * back of the container.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param container The container to be filled, it must provide pushBack.
+         * @return The input stream, with failbit set if the input was malformed.
+         * @tparam T The type of the values to be read.
+         */
+        template <typename T, typename Container>
+        std::istream& readSequence(std::istream& in, Container& container) {
+            char ch = 0;
+            in >> ch;
+
+            if (in.fail() || ch != '[') {
+                in.setstate(std::ios_base::failbit);
+                return in;
+            }
+
+            in >> std::ws;
+            if (in.peek() == ']') {
+                in.get();
+                return in;
+            }
+
+            do {
+                T value;
+                in >> value;
+
+                if (in.fail()) {
+                    return in;
+                }
+
+                container.pushBack(value);
+                in >> ch;
+            } while (in.good() && ch == ',');
+
+            if (in.fail() || ch != ']') {
+                in.setstate(std::ios_base::failbit);
+            }
+
+            return in;
+        }
+
+    } // namespace details
+
+} // namespace own
+
+#endif // CORE_GUARD_HEADER
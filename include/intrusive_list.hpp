@@ -0,0 +1,833 @@
+#ifndef INTRUSIVE_LIST_GUARD_HEADER
+#define INTRUSIVE_LIST_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::bidirectional_iterator_tag and std::reverse_iterator
+#include <iterator>
+// std::conditional, std::enable_if and std::is_convertible
+#include <type_traits>
+
+namespace own {
+
+    template <typename T, typename Tag>
+    class IntrusiveList;
+
+    namespace details {
+
+        template <typename T, typename Tag, typename U>
+        class IntrusiveIterator;
+
+    } // namespace details
+
+    /**
+     * @brief The links an object needs to be part of an IntrusiveList.
+     *
+     * Objects inherit from a hook, so linking them never allocates. A type can
+     * inherit from several hooks with different tags to be part of several lists at
+     * the same time:
+     *
+     *     struct Timer : own::IntrusiveHook<>, own::IntrusiveHook<ExpiredTag> {...};
+     *
+     * A hook unlinks itself when it's destroyed, copies are never linked.
+     *
+     * @tparam Tag Distinguishes the hooks of the same object, void by default.
+     */
+    template <typename Tag = void>
+    class IntrusiveHook {
+      public:
+        /**
+         * @brief Constructs an unlinked hook.
+         *
+         * Complexity: O(1)
+         */
+        IntrusiveHook() : _back(NULL), _next(NULL) {}
+
+        /**
+         * @brief Copy constructor, the links are not copied.
+         *
+         * Complexity: O(1)
+         */
+        IntrusiveHook(const IntrusiveHook<Tag>&) : _back(NULL), _next(NULL) {}
+
+        /**
+         * @brief Destructor, the object is unlinked from its list.
+         *
+         * Complexity: O(1)
+         */
+        ~IntrusiveHook() { this->unlink(); }
+
+        /**
+         * @brief Checks if the object is part of a list.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if it's linked, false otherwise.
+         */
+        inline bool linked() const { return this->_next != NULL; }
+
+        /**
+         * @brief Unlinks the object from whatever list it's part of, without knowing
+         * the list.
+         *
+         * Complexity: O(1)
+         */
+        inline void unlink() {
+            if (this->_next) {
+                this->_back->_next = this->_next;
+                this->_next->_back = this->_back;
+
+                this->_back = NULL;
+                this->_next = NULL;
+            }
+        }
+
+        /**
+         * @brief Assignment operator, the links are kept as they are.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to this hook.
+         */
+        inline IntrusiveHook<Tag>& operator=(const IntrusiveHook<Tag>&) { return *this; }
+
+      private:
+        template <typename, typename>
+        friend class IntrusiveList;
+
+        template <typename, typename, typename>
+        friend class details::IntrusiveIterator;
+
+        /**
+         * @brief Links this hook between back and next.
+         *
+         * Complexity: O(1)
+         *
+         * @param back The hook that will precede this one.
+         * @param next The hook that will follow this one.
+         */
+        inline void linkBetween(IntrusiveHook<Tag>* back, IntrusiveHook<Tag>* next) {
+            this->_back = back;
+            this->_next = next;
+            back->_next = this;
+            next->_back = this;
+        }
+
+        /**
+         * @brief Pointer to the previous hook.
+         */
+        IntrusiveHook<Tag>* _back;
+        /**
+         * @brief Pointer to the next hook.
+         */
+        IntrusiveHook<Tag>* _next;
+    };
+
+    namespace details {
+
+        /**
+         * @brief A bidirectional iterator over the objects of an intrusive list.
+         *
+         * The list is circular around its root hook, which is the end iterator, so
+         * the end iterator can be decremented into the last object.
+         *
+         * @tparam T The type of the objects.
+         * @tparam Tag The tag of the hook.
+         * @tparam U T for a mutable iterator, const T otherwise.
+         */
+        template <typename T, typename Tag, typename U>
+        class IntrusiveIterator {
+            typedef typename std::conditional<std::is_const<U>::value,
+                                              const IntrusiveHook<Tag>,
+                                              IntrusiveHook<Tag> >::type Hook;
+
+          public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef U* pointer;
+            typedef U& reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            IntrusiveIterator() : _hook(NULL) {}
+
+            /**
+             * @brief Constructs an iterator pointing to a hook.
+             *
+             * Complexity: O(1)
+             *
+             * @param hook The hook, the root of the list for the end iterator.
+             */
+            explicit IntrusiveIterator(Hook* hook) : _hook(hook) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename V, typename = typename std::enable_if<
+                                      std::is_convertible<V*, U*>::value>::type>
+            IntrusiveIterator(const IntrusiveIterator<T, Tag, V>& other)
+                : _hook(other.hook()) {}
+
+            /**
+             * @brief Returns the hook the iterator points to.
+             *
+             * Complexity: O(1)
+             *
+             * @return The hook, the root of the list if it's the end iterator.
+             */
+            inline Hook* hook() const { return this->_hook; }
+
+            // Standard bidirectional iterator operations, all of them O(1).
+
+            inline reference operator*() const { return *static_cast<U*>(this->_hook); }
+            inline pointer operator->() const { return static_cast<U*>(this->_hook); }
+
+            inline IntrusiveIterator& operator++() {
+                this->_hook = this->_hook->_next;
+                return *this;
+            }
+            inline IntrusiveIterator operator++(int) {
+                IntrusiveIterator it = *this;
+                this->_hook = this->_hook->_next;
+                return it;
+            }
+            inline IntrusiveIterator& operator--() {
+                this->_hook = this->_hook->_back;
+                return *this;
+            }
+            inline IntrusiveIterator operator--(int) {
+                IntrusiveIterator it = *this;
+                this->_hook = this->_hook->_back;
+                return it;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend inline bool operator==(const IntrusiveIterator& a,
+                                          const IntrusiveIterator& b) {
+                return a._hook == b._hook;
+            }
+            friend inline bool operator!=(const IntrusiveIterator& a,
+                                          const IntrusiveIterator& b) {
+                return a._hook != b._hook;
+            }
+
+          private:
+            /**
+             * @brief The current hook.
+             */
+            Hook* _hook;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A double-linked list of objects that embed their own links.
+     *
+     * The list never allocates nor owns its objects, it links them through the
+     * IntrusiveHook<Tag> they inherit from. Elements are handled as pointers, so the
+     * list can be used as the container of Queue<T*, IntrusiveList<T> > or
+     * Stack<T*, IntrusiveList<T> >.
+     *
+     * Since objects can unlink themselves without knowing their list, the length is
+     * not cached and len() walks the list, empty() is always O(1).
+     *
+     * @tparam T The type of the objects, it must inherit from IntrusiveHook<Tag>.
+     * @tparam Tag The tag of the hook used by this list, void by default.
+     */
+    template <typename T, typename Tag = void>
+    class IntrusiveList {
+        typedef IntrusiveHook<Tag> Hook;
+
+      public:
+        /**
+         * @brief Iterators over the objects of this list.
+         */
+        typedef details::IntrusiveIterator<T, Tag, T> iterator;
+        typedef details::IntrusiveIterator<T, Tag, const T> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Complexity: O(1)
+         */
+        IntrusiveList() { this->root._back = this->root._next = &this->root; }
+
+        /**
+         * @brief Move constructor, the objects are taken over and other is left
+         * empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be moved.
+         */
+        IntrusiveList(IntrusiveList<T, Tag>&& other) {
+            this->root._back = this->root._next = &this->root;
+            this->swap(other);
+        }
+
+        /**
+         * @brief Destructor, every object is unlinked.
+         *
+         * Complexity: O(n)
+         */
+        ~IntrusiveList() {
+            this->clear();
+            this->root._back = this->root._next = NULL;
+        }
+
+        /**
+         * @brief Checks if the list is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        inline bool empty() const { return this->root._next == &this->root; }
+
+        /**
+         * @brief Returns the length of the list.
+         *
+         * Complexity: O(n)
+         *
+         * @return The length of the list.
+         */
+        usize len() const {
+            usize len = 0;
+            for (const Hook* it = this->root._next; it != &this->root; it = it->_next) {
+                len++;
+            }
+            return len;
+        }
+
+        /**
+         * @brief Returns the first object of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the first object.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T* front() const { return this->object(this->root._next); }
+
+        /**
+         * @brief Returns the last object of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the last object.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T* back() const { return this->object(this->root._back); }
+
+        /**
+         * @brief Returns an iterator to the first object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline iterator begin() { return iterator(this->root._next); }
+
+        /**
+         * @brief Returns an iterator to the first object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline const_iterator begin() const { return const_iterator(this->root._next); }
+
+        /**
+         * @brief Returns an iterator past the last object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline iterator end() { return iterator(&this->root); }
+
+        /**
+         * @brief Returns an iterator past the last object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const { return const_iterator(&this->root); }
+
+        /**
+         * @brief Returns a const iterator to the first object, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to cend() if the list is empty.
+         */
+        inline const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last object, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a reverse iterator to the last object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a reverse iterator before the first object.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Returns a cursor to an object of this list.
+         *
+         * Complexity: O(1)
+         *
+         * @param object The object, it must be linked to this list.
+         * @return The cursor.
+         */
+        inline iterator cursor(T* object) { return iterator(this->hook(object)); }
+
+        /**
+         * @brief Links an object at the front of the list, it's unlinked first if it
+         * was part of a list.
+         *
+         * Complexity: O(1)
+         *
+         * @param object The object to be linked.
+         * @return A cursor to the object.
+         */
+        inline iterator pushFront(T* object) {
+            return this->insertAfter(this->end(), object);
+        }
+
+        /**
+         * @brief Unlinks the first object of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the unlinked object.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T* popFront() { return this->remove(this->front()); }
+
+        /**
+         * @brief Links an object at the back of the list, it's unlinked first if it
+         * was part of a list.
+         *
+         * Complexity: O(1)
+         *
+         * @param object The object to be linked.
+         * @return A cursor to the object.
+         */
+        inline iterator pushBack(T* object) {
+            return this->insertBefore(this->end(), object);
+        }
+
+        /**
+         * @brief Unlinks the last object of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the unlinked object.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T* popBack() { return this->remove(this->back()); }
+
+        /**
+         * @brief Links an object after the one pointed by the cursor, it's unlinked
+         * first if it was part of a list.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() links at the front.
+         * @param object The object to be linked.
+         * @return A cursor to the object.
+         */
+        iterator insertAfter(iterator pos, T* object) {
+            Hook* hook = this->hook(object);
+            if (hook != pos.hook()) {
+                hook->unlink();
+                hook->linkBetween(pos.hook(), pos.hook()->_next);
+            }
+            return iterator(hook);
+        }
+
+        /**
+         * @brief Links an object before the one pointed by the cursor, it's unlinked
+         * first if it was part of a list.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() links at the back.
+         * @param object The object to be linked.
+         * @return A cursor to the object.
+         */
+        iterator insertBefore(iterator pos, T* object) {
+            Hook* hook = this->hook(object);
+            if (hook != pos.hook()) {
+                hook->unlink();
+                hook->linkBetween(pos.hook()->_back, pos.hook());
+            }
+            return iterator(hook);
+        }
+
+        /**
+         * @brief Unlinks an object of this list.
+         *
+         * Complexity: O(1)
+         *
+         * @param object The object to be unlinked.
+         * @return The object.
+         */
+        inline T* remove(T* object) {
+            this->hook(object)->unlink();
+            return object;
+        }
+
+        /**
+         * @brief Unlinks the object pointed by the cursor.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor to the object to be unlinked.
+         * @return A cursor to the object that followed the unlinked one.
+         *
+         * @note it's undefined behavior if pos is end().
+         */
+        iterator erase(iterator pos) {
+            Hook* next = pos.hook()->_next;
+            pos.hook()->unlink();
+            return iterator(next);
+        }
+
+        /**
+         * @brief Checks if an object is linked to this list.
+         *
+         * Complexity: O(n)
+         *
+         * @param object The object to be checked.
+         * @return True if the object is part of this list, false otherwise.
+         */
+        bool contains(const T* object) const {
+            const Hook* hook = object;
+            if (!hook->linked()) {
+                return false;
+            }
+
+            for (const Hook* it = this->root._next; it != &this->root; it = it->_next) {
+                if (it == hook) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Unlinks the objects in the list that don't match the given filter.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A callable that takes a reference to an object and returns
+         * true if it should be retained, false otherwise.
+         * @return The number of objects that were unlinked.
+         * @tparam Filter The callable data-type
+         */
+        template <typename Filter>
+        usize retainIf(Filter filter) {
+            return this->unlinkWhere([&filter](T& object) { return !filter(object); });
+        }
+
+        /**
+         * @brief Unlinks the objects in the list that match the given filter.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A callable that takes a reference to an object and returns
+         * true if it should be unlinked, false otherwise.
+         * @return The number of objects that were unlinked.
+         * @tparam Filter The callable data-type
+         */
+        template <typename Filter>
+        usize removeIf(Filter filter) {
+            return this->unlinkWhere(filter);
+        }
+
+        /**
+         * @brief Moves every object of other to the end of this list, other is left
+         * empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be appended.
+         */
+        void append(IntrusiveList<T, Tag>& other) {
+            if (other.empty() || this == &other) {
+                return;
+            }
+
+            Hook* first = other.root._next;
+            Hook* last = other.root._back;
+
+            first->_back = this->root._back;
+            this->root._back->_next = first;
+
+            last->_next = &this->root;
+            this->root._back = last;
+
+            other.root._back = other.root._next = &other.root;
+        }
+
+        /**
+         * @brief Reverses the order of the objects.
+         *
+         * Complexity: O(n)
+         */
+        void reverse() {
+            Hook* it = &this->root;
+            do {
+                std::swap(it->_back, it->_next);
+                it = it->_back;
+            } while (it != &this->root);
+        }
+
+        /**
+         * @brief Unlinks every object, none of them is destroyed.
+         *
+         * Complexity: O(n)
+         */
+        void clear() {
+            while (!this->empty()) {
+                this->root._next->unlink();
+            }
+        }
+
+        /**
+         * @brief Swaps the objects of this list with another list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to swap with.
+         */
+        void swap(IntrusiveList<T, Tag>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            Hook mine;
+            adopt(mine, this->root);
+            adopt(this->root, other.root);
+            adopt(other.root, mine);
+        }
+
+        /**
+         * @brief Applies the given action to each object in the list.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The callable to apply to every object, it takes a reference.
+         * @tparam Action The callable data-type
+         */
+        template <typename Action>
+        void forEach(Action action) const {
+            for (Hook* it = this->root._next; it != &this->root;) {
+                // the action may unlink the object
+                Hook* next = it->_next;
+                action(*this->object(it));
+                it = next;
+            }
+        }
+
+        /**
+         * Folds the list by applying an action to each object.
+         * The action can be any callable taking two parameters: T&, B&.
+         *
+         * @param action   The callable to be applied to each object.
+         * @param initial  The initial value for folding.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) const {
+            for (Hook* it = this->root._next; it != &this->root; it = it->_next) {
+                action(*this->object(it), initial);
+            }
+
+            return initial;
+        }
+
+        /**
+         * @brief Move assignment operator, the current objects are unlinked and the
+         * ones of other are taken over.
+         *
+         * Complexity: O(n), as the current objects are unlinked
+         *
+         * @param other The list to move from.
+         * @return A reference to this list.
+         */
+        IntrusiveList<T, Tag>& operator=(IntrusiveList<T, Tag>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->swap(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the output stream operator to print the objects of the
+         * list.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param list The list to print.
+         * @return The output stream after printing the list.
+         */
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const IntrusiveList<T, Tag>& list) {
+            out << '[';
+
+            for (const_iterator it = list.begin(); it != list.end(); ++it) {
+                if (it != list.begin()) {
+                    out << ", ";
+                }
+                out << *it;
+            }
+
+            out << ']';
+            return out;
+        }
+
+      private:
+        /**
+         * @brief Objects can't be part of two lists through the same hook.
+         */
+        IntrusiveList(const IntrusiveList<T, Tag>&) = delete;
+        void operator=(const IntrusiveList<T, Tag>&) = delete;
+
+        /**
+         * @brief Returns the hook of an object.
+         *
+         * Complexity: O(1)
+         */
+        static inline Hook* hook(T* object) { return object; }
+
+        /**
+         * @brief Returns the object owning a hook.
+         *
+         * Complexity: O(1)
+         */
+        static inline T* object(Hook* hook) { return static_cast<T*>(hook); }
+
+        /**
+         * @brief Makes dest the root of the chain of src, src is left empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param dest The root that takes the chain over.
+         * @param src The root that gives the chain away.
+         */
+        static void adopt(Hook& dest, Hook& src) {
+            if (src._next == &src || src._next == NULL) {
+                dest._back = dest._next = &dest;
+            } else {
+                dest._back = src._back;
+                dest._next = src._next;
+                dest._back->_next = &dest;
+                dest._next->_back = &dest;
+            }
+
+            src._back = src._next = &src;
+        }
+
+        /**
+         * @brief Unlinks every object matching the predicate.
+         *
+         * Complexity: O(n)
+         *
+         * @param remove A callable that returns true if the object must be unlinked.
+         * @return The number of objects that were unlinked.
+         */
+        template <typename Predicate>
+        usize unlinkWhere(Predicate remove) {
+            usize count = 0;
+
+            for (Hook* it = this->root._next; it != &this->root;) {
+                Hook* next = it->_next;
+
+                if (remove(*this->object(it))) {
+                    it->unlink();
+                    count++;
+                }
+
+                it = next;
+            }
+
+            return count;
+        }
+
+      private:
+        /**
+         * @brief The root of the circular chain, it's not part of any object.
+         */
+        Hook root;
+    };
+
+} // namespace own
+
+#endif // INTRUSIVE_LIST_GUARD_HEADER
@@ -1,46 +1,29 @@
 #ifndef LIST_GUARD_HEADER
 #define LIST_GUARD_HEADER
 
-// std::swap
+#include "core.hpp"
+
+// std::swap and std::move
 #include <algorithm>
-// std::usize and NULL
-#include <cstddef>
 // std::ostream operator<< overloading
 #include <ostream>
 // std::istream operator>> overloading
 #include <istream>
 // std::out_of_range exception
 #include <stdexcept>
-// std::memmove
-#include <cstring>
+// std::invoke_result, std::decay, std::enable_if and std::is_convertible
+#include <type_traits>
+// placement new
+#include <new>
+// std::move, std::forward and std::in_place
+#include <utility>
+// std::bidirectional_iterator_tag, std::reverse_iterator and std::distance
+#include <iterator>
+// std::initializer_list
+#include <initializer_list>
 
 namespace own {
 
-    /**
-     * @brief Typedef for an unsigned integer representing size.
-     *
-     * This typedef is used to define an alias `usize` for `std::size_t`.
-     * It is commonly used to represent the size of objects or arrays.
-     */
-    typedef std::size_t usize;
-
-    /**
-     * @brief Typedef for a signed long integer representing size.
-     *
-     * This typedef is used to define an alias `isize` for `signed long`.
-     * It is commonly used to represent the size of objects or arrays, but in signed
-     * form.
-     */
-    typedef signed long isize;
-
-    /**
-     * @brief Constant representing the absence of a valid position.
-     *
-     * This constant `NO_POS` is defined with a value of -1.
-     * It is commonly used to indicate the absence of a valid position or index.
-     */
-    const usize NO_POS = -1;
-
     namespace details {
 
         /**
@@ -61,11 +44,35 @@ namespace own {
              * @param back  The previous node in the linked list.
              * @param next  The next node in the linked list.
              */
-            Node(T value, Node<T>* back, Node<T>* next) {
-                this->_value = value;
-                this->_back = back;
-                this->_next = next;
-            }
+            Node(const T& value, Node<T>* back, Node<T>* next)
+                : _value(value), _back(back), _next(next) {}
+
+            /**
+             * @brief Constructs a new node moving the given value, previous node, and
+             * next node.
+             *
+             * Complexity: O(1)
+             *
+             * @param value The value to be moved into the node.
+             * @param back  The previous node in the linked list.
+             * @param next  The next node in the linked list.
+             */
+            Node(T&& value, Node<T>* back, Node<T>* next)
+                : _value(std::move(value)), _back(back), _next(next) {}
+
+            /**
+             * @brief Constructs a new node building the value in place from the given
+             * arguments.
+             *
+             * Complexity: O(1)
+             *
+             * @param back  The previous node in the linked list.
+             * @param next  The next node in the linked list.
+             * @param args  The arguments forwarded to the constructor of T.
+             */
+            template <typename... Args>
+            Node(std::in_place_t, Node<T>* back, Node<T>* next, Args&&... args)
+                : _value(std::forward<Args>(args)...), _back(back), _next(next) {}
 
             /**
              * @brief Constructs a new node with the given value and sets previous and
@@ -75,11 +82,17 @@ namespace own {
              *
              * @param value The value to be stored in the node.
              */
-            Node(T value) {
-                this->_value = value;
-                this->_back = NULL;
-                this->_next = NULL;
-            }
+            Node(const T& value) : _value(value), _back(NULL), _next(NULL) {}
+
+            /**
+             * @brief Constructs a new node moving the given value and sets previous
+             * and next nodes to NULL.
+             *
+             * Complexity: O(1)
+             *
+             * @param value The value to be moved into the node.
+             */
+            Node(T&& value) : _value(std::move(value)), _back(NULL), _next(NULL) {}
 
             /**
              * @brief Returns the value stored in the node.
@@ -435,16 +448,250 @@ namespace own {
              */
             Node<T>* _next;
         };
+
+        /**
+         * @brief A bidirectional iterator over the nodes of a list.
+         *
+         * Besides the node it keeps where the list stores its tail, so the end
+         * iterator can be decremented into the last element.
+         *
+         * @tparam T The type of the values stored in the nodes.
+         * @tparam NodeT Node<T> for a mutable iterator, const Node<T> otherwise.
+         */
+        template <typename T, typename NodeT>
+        class ListIterator {
+          public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef typename std::conditional<std::is_const<NodeT>::value, const T*,
+                                              T*>::type pointer;
+            typedef typename std::conditional<std::is_const<NodeT>::value, const T&,
+                                              T&>::type reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            ListIterator() : _node(NULL), tail(NULL) {}
+
+            /**
+             * @brief Constructs an iterator pointing to a node.
+             *
+             * Complexity: O(1)
+             *
+             * @param node The node, NULL for the end of the list.
+             * @param tail Where the list stores its tail.
+             */
+            ListIterator(NodeT* node, Node<T>* const* tail) : _node(node), tail(tail) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename OtherNode,
+                      typename = typename std::enable_if<
+                          std::is_convertible<OtherNode*, NodeT*>::value>::type>
+            ListIterator(const ListIterator<T, OtherNode>& other)
+                : _node(other.node()), tail(other.tailRef()) {}
+
+            /**
+             * @brief Returns the node the iterator points to.
+             *
+             * Complexity: O(1)
+             *
+             * @return The node, NULL if it's the end of the list.
+             */
+            inline NodeT* node() const { return this->_node; }
+
+            /**
+             * @brief Returns where the list stores its tail.
+             *
+             * Complexity: O(1)
+             *
+             * @return A pointer to the tail of the list.
+             */
+            inline Node<T>* const* tailRef() const { return this->tail; }
+
+            // Standard bidirectional iterator operations, all of them O(1).
+
+            inline reference operator*() const { return this->_node->value(); }
+            inline pointer operator->() const { return &this->_node->value(); }
+
+            inline ListIterator& operator++() {
+                this->_node = this->_node->next();
+                return *this;
+            }
+            inline ListIterator operator++(int) {
+                ListIterator it = *this;
+                this->_node = this->_node->next();
+                return it;
+            }
+            inline ListIterator& operator--() {
+                this->_node = this->_node ? this->_node->back() : *this->tail;
+                return *this;
+            }
+            inline ListIterator operator--(int) {
+                ListIterator it = *this;
+                --*this;
+                return it;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend inline bool operator==(const ListIterator& a, const ListIterator& b) {
+                return a._node == b._node;
+            }
+            friend inline bool operator!=(const ListIterator& a, const ListIterator& b) {
+                return a._node != b._node;
+            }
+
+          private:
+            /**
+             * @brief The current node.
+             */
+            NodeT* _node;
+            /**
+             * @brief Where the list stores its tail.
+             */
+            Node<T>* const* tail;
+        };
+
+        /**
+         * @brief Checks if an allocator can prepare many allocations at once.
+         */
+        template <typename A, typename = void>
+        struct HasReserve : std::false_type {};
+
+        template <typename A>
+        struct HasReserve<A, std::void_t<decltype(std::declval<A&>().reserve(usize()))> >
+            : std::true_type {};
+
     } // namespace details
 
+    /**
+     * @brief The default node allocator, every node is a separate heap allocation.
+     *
+     * An allocator hands out uninitialized storage for exactly one T at a time, the
+     * list is in charge of constructing and destroying the node in it.
+     *
+     * @tparam T The type of the objects being allocated.
+     */
+    template <typename T>
+    class HeapAllocator {
+      public:
+        /**
+         * @brief Allocates uninitialized storage for one object.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the allocated storage.
+         * @throws std::bad_alloc if the allocation fails.
+         */
+        inline T* allocate() { return static_cast<T*>(::operator new(sizeof(T))); }
+
+        /**
+         * @brief Releases storage previously returned by allocate.
+         *
+         * Complexity: O(1)
+         *
+         * @param ptr The storage to be released.
+         */
+        inline void deallocate(T* ptr) { ::operator delete(ptr); }
+
+        /**
+         * @brief Checks if storage of one allocator can be released by the other.
+         *
+         * Complexity: O(1)
+         *
+         * @return Always true, the heap is shared by everyone.
+         */
+        inline bool operator==(const HeapAllocator<T>&) const { return true; }
+
+        /**
+         * @brief Checks if storage of one allocator cannot be released by the other.
+         *
+         * Complexity: O(1)
+         *
+         * @return Always false, the heap is shared by everyone.
+         */
+        inline bool operator!=(const HeapAllocator<T>&) const { return false; }
+    };
+
+    /**
+     * @brief What a list has been doing, see List::stats.
+     *
+     * Counting happens only when OWN_LIST_STATS is defined before including the
+     * header, otherwise lists have no counters and every field reads 0.
+     */
+    struct ListStats {
+        /**
+         * @brief Nodes obtained from, and given back to, the allocator.
+         */
+        usize allocations = 0;
+        usize frees = 0;
+        /**
+         * @brief Elements constructed in the list, and elements removed by pops,
+         * remove, erase or a filter. Elements moved between lists by splice, append
+         * or sliceOff are not counted.
+         */
+        usize pushes = 0;
+        usize pops = 0;
+        /**
+         * @brief The largest length the list had.
+         */
+        usize peakLen = 0;
+        /**
+         * @brief Lookups by index that had to walk, and the nodes they walked.
+         *
+         * Many walks of about len / 4 steps each point to an operator[] loop.
+         */
+        usize walks = 0;
+        usize walkSteps = 0;
+        /**
+         * @brief Times the elements of this list were copied into another list, by
+         * a copy, operator+ or operator+=, and the elements copied by them.
+         */
+        usize copies = 0;
+        usize copiedElements = 0;
+        /**
+         * @brief O(n) reorderings, reverse and sort.
+         */
+        usize reversals = 0;
+        usize sorts = 0;
+    };
+
     /**
      * @brief A template class for a double-linked list implementation.
      *
+     * Defining OWN_LIST_STATS before including this header makes every list count
+     * its allocations, walks and copies, see stats.
+     *
      * @tparam T The type of elements stored in the list.
+     * @tparam Allocator The allocator template used to obtain the nodes, it's
+     * instantiated with details::Node<T>.
      */
-    template <typename T>
+    template <typename T, template <typename> class Allocator = HeapAllocator>
     class List {
       public:
+        /**
+         * @brief The allocator type used for the nodes of this list.
+         */
+        typedef Allocator<details::Node<T> > NodeAllocator;
+
+        /**
+         * @brief Iterators over the elements of this list.
+         */
+        typedef details::ListIterator<T, details::Node<T> > iterator;
+        typedef details::ListIterator<T, const details::Node<T> > const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
         /**
          * @brief Default constructor.
          *
@@ -459,21 +706,86 @@ namespace own {
             this->_len = 0;
         }
 
+        /**
+         * @brief Constructs an empty list that obtains its nodes from the given
+         * allocator.
+         *
+         * Complexity: O(1)
+         *
+         * @param allocator The allocator to be used.
+         */
+        List(const NodeAllocator& allocator) : allocator(allocator) {
+            this->head = NULL;
+            this->tail = NULL;
+            this->_len = 0;
+        }
+
+        /**
+         * @brief Constructs a list holding a copy of the given values, in order.
+         *
+         * Complexity: O(n)
+         *
+         * @param values The values of the list.
+         */
+        List(std::initializer_list<T> values) : List() {
+            this->pushBackN(values.begin(), values.end());
+        }
+
+        /**
+         * @brief Constructs a list holding a copy of the elements from first to
+         * last, in order.
+         *
+         * Complexity: O(n)
+         *
+         * @param first The first element to be copied.
+         * @param last Past the last element to be copied.
+         * @param allocator The allocator to be used.
+         */
+        template <typename Iterator,
+                  typename = typename std::iterator_traits<Iterator>::iterator_category>
+        List(Iterator first, Iterator last,
+             const NodeAllocator& allocator = NodeAllocator())
+            : List(allocator) {
+            this->pushBackN(first, last);
+        }
+
         /**
          * @brief Copy constructor.
          *
-         * Creates a new list by copying the contents of another list.
+         * Creates a new list by copying the contents of another list, the allocator
+         * is copied as well.
          *
          * Complexity: O(n)
          *
          * @param other The list to be copied.
          */
-        List(const List<T>& other) {
+        List(const List<T, Allocator>& other) : allocator(other.allocator) {
             this->head = NULL;
             this->tail = NULL;
             this->_len = 0;
 
-            *this = other;
+            this->copyNodes(other);
+            this->recordPushes(this->_len);
+            other.recordCopy();
+        }
+
+        /**
+         * @brief Move constructor.
+         *
+         * Takes over the nodes of another list, which is left empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be moved.
+         */
+        List(List<T, Allocator>&& other) : allocator(other.allocator) {
+            this->head = other.head;
+            this->tail = other.tail;
+            this->_len = other._len;
+
+            other.head = NULL;
+            other.tail = NULL;
+            other._len = 0;
         }
 
         /**
@@ -503,6 +815,35 @@ namespace own {
          */
         inline usize len() const { return this->_len; }
 
+        /**
+         * @brief Returns what this list has been doing since it was constructed or
+         * since the last resetStats.
+         *
+         * Complexity: O(1)
+         *
+         * @return The counters, all of them 0 unless OWN_LIST_STATS is defined.
+         */
+        inline const ListStats& stats() const {
+#ifdef OWN_LIST_STATS
+            return this->_stats;
+#else
+            static const ListStats none;
+            return none;
+#endif
+        }
+
+        /**
+         * @brief Sets every counter back to 0, the peak starts at the current length.
+         *
+         * Complexity: O(1)
+         */
+        inline void resetStats() {
+#ifdef OWN_LIST_STATS
+            this->_stats = ListStats();
+            this->_stats.peakLen = this->_len;
+#endif
+        }
+
         /**
          * @brief Get the value of the front element of the list.
          *
@@ -584,85 +925,249 @@ namespace own {
         inline T& back() { return this->tail->value(); }
 
         /**
-         * @brief Insert a new element at the front of the list.
+         * @brief Returns an iterator to the first element.
          *
          * Complexity: O(1)
          *
-         * @param value The value of the new element.
+         * @return The iterator, equal to end() if the list is empty.
          */
-        void pushFront(T value) {
-            details::Node<T>* node = new details::Node<T>(value, NULL, this->head);
-
-            if (this->head) {
-                this->head->setBack(node);
-            } else {
-                this->tail = node;
-            }
-
-            this->head = node;
-            this->_len++;
-        }
+        inline iterator begin() { return iterator(this->head, &this->tail); }
 
         /**
-         * @brief Removes and returns the first element of the list.
+         * @brief Returns an iterator to the first element.
          *
          * Complexity: O(1)
          *
-         * @return The value of the removed element.
-         *
-         * @note it's undefined behavior if list is empty.
+         * @return The iterator, equal to end() if the list is empty.
          */
-        T popFront() {
-            details::Node<T>* node = this->head;
-            T value = node->value();
-
-            this->_len--;
-
-            this->head = node->next();
-            if (this->head == NULL) {
-                this->tail = NULL;
-            }
-
-            node->unlink();
-            delete node;
-
-            return value;
+        inline const_iterator begin() const {
+            return const_iterator(this->head, &this->tail);
         }
 
         /**
-         * @brief Adds an element to the end of the list.
+         * @brief Returns an iterator past the last element.
          *
          * Complexity: O(1)
          *
-         * @param value The value to be added.
+         * @return The iterator.
          */
-        void pushBack(T value) {
-            details::Node<T>* node = new details::Node<T>(value, this->tail, NULL);
-
-            if (this->tail) {
-                this->tail->setNext(node);
-            } else {
-                this->head = node;
-            }
-
-            this->tail = node;
-            this->_len++;
-        }
+        inline iterator end() { return iterator(NULL, &this->tail); }
 
         /**
-         * @brief Removes and returns the last element of the list.
+         * @brief Returns an iterator past the last element.
          *
          * Complexity: O(1)
          *
-         * @return The value of the removed element.
-         *
-         * @note it's undefined behavior if list is empty.
+         * @return The iterator.
          */
-        T popBack() {
-            details::Node<T>* node = this->tail;
-            T value = node->value();
+        inline const_iterator end() const { return const_iterator(NULL, &this->tail); }
+
+        /**
+         * @brief Returns a const iterator to the first element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to cend() if the list is empty.
+         */
+        inline const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Insert a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushFront(const T& value) {
+            this->emplaceFront(value);
+            return this->begin();
+        }
+
+        /**
+         * @brief Moves a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushFront(T&& value) {
+            this->emplaceFront(std::move(value));
+            return this->begin();
+        }
+
+        /**
+         * @brief Constructs a new element in place at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            details::Node<T>* node =
+                this->createNode(NULL, this->head, std::forward<Args>(args)...);
+
+            if (this->head) {
+                this->head->setBack(node);
+            } else {
+                this->tail = node;
+            }
+
+            this->head = node;
+            this->_len++;
+            this->recordPushes(1);
+
+            return node->value();
+        }
+
+        /**
+         * @brief Removes and returns the first element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popFront() {
+            details::Node<T>* node = this->head;
+            T value = std::move(node->value());
+
+            this->_len--;
+            this->record(&ListStats::pops);
+
+            this->head = node->next();
+            if (this->head == NULL) {
+                this->tail = NULL;
+            }
+
+            node->unlink();
+            this->destroyNode(node);
+
+            return value;
+        }
+
+        /**
+         * @brief Adds an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushBack(const T& value) {
+            this->emplaceBack(value);
+            return iterator(this->tail, &this->tail);
+        }
+
+        /**
+         * @brief Moves an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushBack(T&& value) {
+            this->emplaceBack(std::move(value));
+            return iterator(this->tail, &this->tail);
+        }
+
+        /**
+         * @brief Constructs a new element in place at the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            details::Node<T>* node =
+                this->createNode(this->tail, NULL, std::forward<Args>(args)...);
+
+            if (this->tail) {
+                this->tail->setNext(node);
+            } else {
+                this->head = node;
+            }
+
+            this->tail = node;
+            this->_len++;
+            this->recordPushes(1);
+
+            return node->value();
+        }
+
+        /**
+         * @brief Removes and returns the last element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popBack() {
+            details::Node<T>* node = this->tail;
+            T value = std::move(node->value());
 
             this->_len--;
+            this->record(&ListStats::pops);
 
             this->tail = node->back();
             if (this->tail == NULL) {
@@ -670,11 +1175,155 @@ namespace own {
             }
 
             node->unlink();
-            delete node;
+            this->destroyNode(node);
 
             return value;
         }
 
+        /**
+         * @brief Constructs count new elements at the end of the list, each one from
+         * what next() returns.
+         *
+         * The nodes are linked in a single pass and the length is updated once, an
+         * allocator providing reserve (as PoolAllocator does) is asked for all of
+         * them up front.
+         *
+         * Complexity: O(m), where m is count
+         *
+         * @param count The amount of elements to be added.
+         * @param next The callable returning the value of every new element, in
+         * order.
+         * @throws Whatever next or the allocator throws, the elements built so far
+         * are kept.
+         */
+        template <typename Generator>
+        void generateBack(usize count, Generator next) {
+            if constexpr (details::HasReserve<NodeAllocator>::value) {
+                this->allocator.reserve(count);
+            }
+
+            details::Node<T>* last = this->tail;
+            usize added = 0;
+
+            try {
+                for (; added < count; added++) {
+                    details::Node<T>* node = this->createNode(last, NULL, next());
+
+                    if (last) {
+                        last->setNext(node);
+                    } else {
+                        this->head = node;
+                    }
+                    last = node;
+                }
+            } catch (...) {
+                this->tail = last;
+                this->_len += added;
+                this->recordPushes(added);
+                throw;
+            }
+
+            this->tail = last;
+            this->_len += added;
+            this->recordPushes(added);
+        }
+
+        /**
+         * @brief Adds a copy of the elements from first to last to the end of the
+         * list.
+         *
+         * A forward range is measured first and built by generateBack, so the nodes
+         * are linked in a single pass and the length is updated once.
+         *
+         * Complexity: O(m), where m is the length of the range
+         *
+         * @param first The first element to be added.
+         * @param last Past the last element to be added.
+         * @throws Whatever copying an element or the allocator throws, the elements
+         * added so far are kept.
+         */
+        template <typename Iterator>
+        void pushBackN(Iterator first, Iterator last) {
+            if constexpr (details::IsForwardIterator<Iterator>::value) {
+                usize count = usize(std::distance(first, last));
+                this->generateBack(count, [&first]() -> decltype(auto) {
+                    return *first++;
+                });
+            } else {
+                for (; first != last; ++first) {
+                    this->pushBack(*first);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes the first n elements of the list, moving them to out from
+         * the front on.
+         *
+         * Complexity: O(m), where m is n or the length if it's shorter
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value.
+         */
+        template <typename Output>
+        Output popFrontN(Output out, usize n) {
+            usize count = n < this->_len ? n : this->_len;
+            details::Node<T>* node = this->head;
+            usize i = 0;
+
+            try {
+                for (; i < count; i++) {
+                    *out = std::move(node->value());
+                    ++out;
+
+                    details::Node<T>* next = node->next();
+                    this->destroyNode(node);
+                    node = next;
+                }
+            } catch (...) {
+                this->popFrontDetached(node, i);
+                throw;
+            }
+
+            this->popFrontDetached(node, count);
+            return out;
+        }
+
+        /**
+         * @brief Removes the last n elements of the list, moving them to out from
+         * the back on.
+         *
+         * Complexity: O(m), where m is n or the length if it's shorter
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value.
+         */
+        template <typename Output>
+        Output popBackN(Output out, usize n) {
+            usize count = n < this->_len ? n : this->_len;
+            details::Node<T>* node = this->tail;
+            usize i = 0;
+
+            try {
+                for (; i < count; i++) {
+                    *out = std::move(node->value());
+                    ++out;
+
+                    details::Node<T>* back = node->back();
+                    this->destroyNode(node);
+                    node = back;
+                }
+            } catch (...) {
+                this->popBackDetached(node, i);
+                throw;
+            }
+
+            this->popBackDetached(node, count);
+            return out;
+        }
+
         /**
          * @brief Inserts an element at the specified index in a forward direction.
          *
@@ -684,7 +1333,22 @@ namespace own {
          * @param value The value to be inserted.
          * @param at The index at which the value should be inserted.
          */
-        inline void insertForward(T value, usize at) { this->insert(value, at, false); }
+        inline void insertForward(const T& value, usize at) {
+            this->insert(at, false, value);
+        }
+
+        /**
+         * @brief Moves an element at the specified index in a forward direction.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n), if 0 < at < len
+         *
+         * @param value The value to be inserted.
+         * @param at The index at which the value should be inserted.
+         */
+        inline void insertForward(T&& value, usize at) {
+            this->insert(at, false, std::move(value));
+        }
 
         /**
          * @brief Inserts an element at the specified index in a backward direction.
@@ -695,7 +1359,320 @@ namespace own {
          * @param value The value to be inserted.
          * @param at The index at which the value should be inserted.
          */
-        inline void insertBackward(T value, usize at) { this->insert(value, at, true); }
+        inline void insertBackward(const T& value, usize at) {
+            this->insert(at, true, value);
+        }
+
+        /**
+         * @brief Moves an element at the specified index in a backward direction.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n), if 0 < at < len
+         *
+         * @param value The value to be inserted.
+         * @param at The index at which the value should be inserted.
+         */
+        inline void insertBackward(T&& value, usize at) {
+            this->insert(at, true, std::move(value));
+        }
+
+        /**
+         * @brief Constructs a new element in place so it ends up at the specified
+         * index, as insertBackward does.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n), if 0 < at < len
+         *
+         * @param at The index at which the element should be constructed.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        inline T& emplace(usize at, Args&&... args) {
+            return this->insert(at, true, std::forward<Args>(args)...)->value();
+        }
+
+        /**
+         * @brief Inserts an element after the one pointed by the cursor.
+         *
+         * Cursors to other elements remain valid.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() inserts at the front.
+         * @param value The value to be inserted.
+         * @return A cursor to the new element.
+         */
+        inline iterator insertAfter(iterator pos, const T& value) {
+            return this->emplaceAfter(pos, value);
+        }
+
+        /**
+         * @brief Moves an element after the one pointed by the cursor.
+         *
+         * Cursors to other elements remain valid.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() inserts at the front.
+         * @param value The value to be inserted.
+         * @return A cursor to the new element.
+         */
+        inline iterator insertAfter(iterator pos, T&& value) {
+            return this->emplaceAfter(pos, std::move(value));
+        }
+
+        /**
+         * @brief Constructs a new element in place after the one pointed by the
+         * cursor.
+         *
+         * Cursors to other elements remain valid.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() inserts at the front.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A cursor to the new element.
+         */
+        template <typename... Args>
+        iterator emplaceAfter(iterator pos, Args&&... args) {
+            details::Node<T>* at = pos.node();
+
+            if (at == NULL) {
+                this->emplaceFront(std::forward<Args>(args)...);
+                return this->begin();
+            }
+            if (at == this->tail) {
+                this->emplaceBack(std::forward<Args>(args)...);
+                return iterator(this->tail, &this->tail);
+            }
+
+            details::Node<T>* node =
+                this->createNode(NULL, NULL, std::forward<Args>(args)...);
+            at->linkNext(node);
+            this->_len++;
+            this->recordPushes(1);
+
+            return iterator(node, &this->tail);
+        }
+
+        /**
+         * @brief Inserts an element before the one pointed by the cursor.
+         *
+         * Cursors to other elements remain valid.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() inserts at the back.
+         * @param value The value to be inserted.
+         * @return A cursor to the new element.
+         */
+        inline iterator insertBefore(iterator pos, const T& value) {
+            return this->emplaceBefore(pos, value);
+        }
+
+        /**
+         * @brief Moves an element before the one pointed by the cursor.
+         *
+         * Cursors to other elements remain valid.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() inserts at the back.
+         * @param value The value to be inserted.
+         * @return A cursor to the new element.
+         */
+        inline iterator insertBefore(iterator pos, T&& value) {
+            return this->emplaceBefore(pos, std::move(value));
+        }
+
+        /**
+         * @brief Constructs a new element in place before the one pointed by the
+         * cursor.
+         *
+         * Cursors to other elements remain valid.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor, end() inserts at the back.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A cursor to the new element.
+         */
+        template <typename... Args>
+        iterator emplaceBefore(iterator pos, Args&&... args) {
+            details::Node<T>* at = pos.node();
+
+            if (at == NULL) {
+                this->emplaceBack(std::forward<Args>(args)...);
+                return iterator(this->tail, &this->tail);
+            }
+            if (at == this->head) {
+                this->emplaceFront(std::forward<Args>(args)...);
+                return this->begin();
+            }
+
+            details::Node<T>* node =
+                this->createNode(NULL, NULL, std::forward<Args>(args)...);
+            at->linkBack(node);
+            this->_len++;
+            this->recordPushes(1);
+
+            return iterator(node, &this->tail);
+        }
+
+        /**
+         * @brief Removes the element pointed by the cursor.
+         *
+         * Only cursors to the removed element are invalidated.
+         *
+         * Complexity: O(1)
+         *
+         * @param pos The cursor to the element to be removed.
+         * @return A cursor to the element that followed the removed one.
+         *
+         * @note it's undefined behavior if pos is end().
+         */
+        iterator erase(iterator pos) {
+            details::Node<T>* node = pos.node();
+            details::Node<T>* next = node->next();
+
+            this->detach(node);
+            this->destroyNode(node);
+
+            return iterator(next, &this->tail);
+        }
+
+        /**
+         * @brief Moves every element of other before the one pointed by the cursor,
+         * other is left empty.
+         *
+         * Cursors to the moved elements remain valid and now belong to this list.
+         *
+         * Complexity: O(1), if both lists share the allocator
+         * Complexity: O(m), otherwise, as elements are moved one by one
+         *
+         * @param pos The cursor, end() moves the elements at the back.
+         * @param other The list whose elements are moved.
+         */
+        void splice(iterator pos, List<T, Allocator>& other) {
+            if (other.empty() || this == &other) {
+                return;
+            }
+            if (this->allocator != other.allocator) {
+                for (details::Node<T>* it = other.head; it; it = it->next()) {
+                    this->emplaceBefore(pos, std::move(it->value()));
+                }
+                other.clear();
+                return;
+            }
+
+            details::Node<T>* at = pos.node();
+            details::Node<T>* before = at ? at->back() : this->tail;
+
+            other.head->setBack(before);
+            other.tail->setNext(at);
+
+            if (before) {
+                before->setNext(other.head);
+            } else {
+                this->head = other.head;
+            }
+            if (at) {
+                at->setBack(other.tail);
+            } else {
+                this->tail = other.tail;
+            }
+
+            this->_len += other._len;
+            this->recordPeak();
+
+            other._len = 0;
+            other.head = NULL;
+            other.tail = NULL;
+        }
+
+        /**
+         * @brief Moves the element pointed by it, which belongs to other, before the
+         * one pointed by pos.
+         *
+         * Other may be this list, so an element can be moved to the front in O(1),
+         * as LRU lists do.
+         *
+         * Complexity: O(1), if both lists share the allocator
+         *
+         * @param pos The cursor of this list, end() moves the element at the back.
+         * @param other The list the element belongs to.
+         * @param it The cursor to the element to be moved.
+         * @return A cursor to the moved element.
+         */
+        iterator splice(iterator pos, List<T, Allocator>& other, iterator it) {
+            details::Node<T>* node = it.node();
+
+            if (this == &other && (node == pos.node() || node->next() == pos.node())) {
+                return iterator(node, &this->tail);
+            }
+            if (this->allocator != other.allocator) {
+                iterator moved = this->emplaceBefore(pos, std::move(node->value()));
+                other.erase(it);
+                return moved;
+            }
+
+            other.detach(node);
+
+            details::Node<T>* at = pos.node();
+            if (at == NULL) {
+                if (this->tail) {
+                    this->tail->linkNext(node);
+                } else {
+                    this->head = node;
+                }
+                this->tail = node;
+            } else {
+                at->linkBack(node);
+                if (at == this->head) {
+                    this->head = node;
+                }
+            }
+
+            this->_len++;
+            this->recordPeak();
+
+            return iterator(node, &this->tail);
+        }
+
+        /**
+         * @brief Returns a cursor to the first occurrence of a specific value.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be found.
+         * @return A cursor to the element, end() if not found.
+         */
+        iterator locate(const T& value) {
+            details::Node<T>* it = this->head;
+            while (it && !(it->value() == value)) {
+                it = it->next();
+            }
+
+            return iterator(it, &this->tail);
+        }
+
+        /**
+         * @brief Returns a cursor to the first occurrence of a specific value.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be found.
+         * @return A cursor to the element, end() if not found.
+         */
+        const_iterator locate(const T& value) const {
+            const details::Node<T>* it = this->head;
+            while (it && !(it->value() == value)) {
+                it = it->next();
+            }
+
+            return const_iterator(it, &this->tail);
+        }
 
         /**
          * @brief Checks if the list contains a specific value.
@@ -712,12 +1689,32 @@ namespace own {
          *
          * If the other list is empty, then it's trivially true
          *
-         * Complexity: O(n^2)
+         * Unless other is tiny, the values of this list are put in a
+         * details::ValueSet first, hashed if std::hash<T> is enabled or sorted if T
+         * has operator<.
+         *
+         * Complexity: O(n + m), if T is hashable
+         * Complexity: O(n log n + m log n), if T is only ordered
+         * Complexity: O(n * m), otherwise
          *
          * @param other The list to be checked.
          * @return True if the list contains all the values, false otherwise.
          */
-        bool contains(const List<T>& other) const {
+        bool contains(const List<T, Allocator>& other) const {
+            if constexpr (details::ValueSet<T>::supported) {
+                if (other._len >= VALUE_SET_MIN_QUERIES) {
+                    details::ValueSet<T> values(this->begin(), this->end(), this->_len);
+
+                    for (details::Node<T>* it = other.head; it; it = it->next()) {
+                        if (!values.has(it->value())) {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+            }
+
             for (details::Node<T>* it = other.head; it; it = it->next()) {
                 if (!this->contains(it->value())) {
                     return false;
@@ -727,6 +1724,42 @@ namespace own {
             return true;
         }
 
+        /**
+         * @brief Counts the occurrences of a specific value in the list.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be counted.
+         * @return How many elements are equal to value.
+         */
+        usize count(const T& value) const {
+            usize count = 0;
+
+            for (details::Node<T>* it = this->head; it; it = it->next()) {
+                if (it->value() == value) {
+                    count++;
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Counts the elements of the list equal to any of the given values.
+         *
+         * Complexity: O(n + m), if T is hashable, see contains(const List&)
+         * Complexity: O(n log m + m log m), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         *
+         * @param values The values to be counted.
+         * @return How many elements are equal to one of the values.
+         */
+        usize count(const List<T, Allocator>& values) const {
+            usize count = 0;
+            this->matchAny(values, [&count](usize) { count++; });
+            return count;
+        }
+
         /**
          * @brief Finds the first occurrence of a specific value in the list.
          *
@@ -735,6 +1768,9 @@ namespace own {
          * @param value The value to be found.
          * @param skip How many elements to ignore.
          * @return The index of the first occurrence of the value, or NO_POS if not found.
+         *
+         * @note Every element is a node hop, so it can't be vectorized. Vector and
+         * UnrolledList compare a register of elements at once, see simd.hpp.
          */
         usize find(const T& value, usize skip = 0) const {
             if (skip >= this->_len) {
@@ -788,6 +1824,9 @@ namespace own {
          *
          * @param value The value to be found.
          * @return A list of indices where the value is found.
+         *
+         * @note To stream the matches into further stages without building a list,
+         * own::view(list).filter(...) in view.hpp does it in the same pass.
          */
         List<usize> findAll(const T& value) const {
             List<usize> indices;
@@ -805,6 +1844,22 @@ namespace own {
             return indices;
         }
 
+        /**
+         * @brief Finds all elements of the list equal to any of the given values.
+         *
+         * Complexity: O(n + m), if T is hashable, see contains(const List&)
+         * Complexity: O(n log m + m log m), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         *
+         * @param values The values to be found.
+         * @return A list of indices where one of the values is found.
+         */
+        List<usize> findAll(const List<T, Allocator>& values) const {
+            List<usize> indices;
+            this->matchAny(values, [&indices](usize at) { indices.pushBack(at); });
+            return indices;
+        }
+
         /**
          * @brief Removes the element at the specified index.
          *
@@ -822,25 +1877,42 @@ namespace own {
          */
         T remove(usize at) {
             if (at == 0) {
-                this->popFront();
-                return;
+                return this->popFront();
             }
             if (at >= this->_len - 1) {
-                this->popBack();
-                return;
+                return this->popBack();
             }
 
             details::Node<T>* node = this->atNode(at);
-            T value = node->value();
+            T value = std::move(node->value());
 
             this->_len--;
+            this->record(&ListStats::pops);
 
             node->unlink();
-            delete node;
+            this->destroyNode(node);
 
             return value;
         }
 
+        /**
+         * @brief Retains only the elements in the list that match the given filter.
+         *
+         * The filter can be any callable, so lambdas can capture their context and
+         * be inlined.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A callable that takes a const reference to an element and
+         * returns true if it should be retained, false otherwise.
+         * @return The number of elements that were removed.
+         * @tparam Filter The callable data-type
+         */
+        template <typename Filter>
+        usize retainIf(Filter filter) {
+            return this->eraseWhere([&filter](const T& value) { return !filter(value); });
+        }
+
         /**
          * @brief Retains only the elements in the list that match the given filter
          * function.
@@ -849,37 +1921,14 @@ namespace own {
          *
          * @param filter A filter function that takes an element and returns true if it
          * should be retained, false otherwise.
-         * @param ctx The context of filter.
-         * @return The number of elements that were removed.
-         * @tparam Context The context data-type
-         */
-        template <typename Context>
-        usize retainIf(bool (*filter)(const T&, Context&), Context& ctx) {
-            usize oldOld = this->_len;
-
-            details::Node<T>* it = this->head;
-            while (it) {
-                if (filter(*it, ctx)) {
-                    it = it->next();
-                } else {
-                    this->_len--;
-                    details::Node<T>* next = it->next();
-
-                    if (it == this->head) {
-                        this->head = next;
-                    }
-                    if (it == this->tail) {
-                        this->tail = next;
-                    }
-
-                    it->unlink();
-                    delete it;
-
-                    it = next;
-                }
-            }
-
-            return oldOld - this->_len;
+         * @param ctx The context of filter.
+         * @return The number of elements that were removed.
+         * @tparam Context The context data-type
+         */
+        template <typename Context>
+        usize retainIf(bool (*filter)(const T&, Context&), Context& ctx) {
+            return this->eraseWhere(
+                [filter, &ctx](const T& value) { return !filter(value, ctx); });
         }
 
         /**
@@ -893,31 +1942,25 @@ namespace own {
          * @return The number of elements that were removed.
          */
         usize retainIf(bool (*filter)(const T&)) {
-            usize oldLen = this->_len;
-
-            details::Node<T>* it = this->head;
-            while (it) {
-                if (filter(*it)) {
-                    it = it->next();
-                } else {
-                    this->_len--;
-                    details::Node<T>* next = it->next();
-
-                    if (it == this->head) {
-                        this->head = next;
-                    }
-                    if (it == this->tail) {
-                        this->tail = next;
-                    }
-
-                    it->unlink();
-                    delete it;
-
-                    it = next;
-                }
-            }
+            return this->eraseWhere([filter](const T& value) { return !filter(value); });
+        }
 
-            return oldLen - this->_len;
+        /**
+         * @brief Removes all elements from the list that match the given filter.
+         *
+         * The filter can be any callable, so lambdas can capture their context and
+         * be inlined.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A callable that takes a const reference to an element and
+         * returns true if it should be removed, false otherwise.
+         * @return The number of elements that were removed.
+         * @tparam Filter The callable data-type
+         */
+        template <typename Filter>
+        usize removeIf(Filter filter) {
+            return this->eraseWhere(filter);
         }
 
         /**
@@ -934,24 +1977,8 @@ namespace own {
          */
         template <typename Context>
         usize removeIf(bool (*filter)(const T&, Context&), Context& ctx) {
-            usize oldLen = this->_len;
-
-            details::Node<T>* it = this->head;
-            while (it) {
-                if (filter(*it, ctx)) {
-                    this->_len--;
-                    details::Node<T>* next = it->next();
-
-                    it->unlink();
-                    delete it;
-
-                    it = next;
-                } else {
-                    it = it->next();
-                }
-            }
-
-            return oldLen - this->_len;
+            return this->eraseWhere(
+                [filter, &ctx](const T& value) { return filter(value, ctx); });
         }
 
         /**
@@ -963,38 +1990,25 @@ namespace own {
          * should be removed, false otherwise.
          * @return The number of elements that were removed.
          */
-        usize removeIf(bool (*filter)(const T&)) {
-            usize oldLen = this->_len;
-
-            details::Node<T>* it = this->head;
-            while (it) {
-                if (filter(*it)) {
-                    this->_len--;
-                    details::Node<T>* next = it->next();
-
-                    it->unlink();
-                    delete it;
-
-                    it = next;
-                } else {
-                    it = it->next();
-                }
-            }
-
-            return oldLen - this->_len;
-        }
+        usize removeIf(bool (*filter)(const T&)) { return this->eraseWhere(filter); }
 
         /**
          * @brief This function appends the elements in the provided list to the end
          * of the current list.
          *
-         * Complexity: O(1)
+         * Complexity: O(1), if both lists share the allocator
+         * Complexity: O(m), otherwise, as elements are copied and other is cleared
          *
          * @param other The list to be appended.
          * @tparam T The type of elements in the list.
          */
-        void append(List<T>& other) {
-            if (other.isEmpty()) {
+        void append(List<T, Allocator>& other) {
+            if (other.empty() || this == &other) {
+                return;
+            }
+            if (this->allocator != other.allocator) {
+                *this += other;
+                other.clear();
                 return;
             }
             if (this->_len == 0) {
@@ -1003,6 +2017,7 @@ namespace own {
             }
 
             this->_len += other._len;
+            this->recordPeak();
 
             this->tail->setNext(other.head);
             other.head->setBack(this->tail);
@@ -1014,6 +2029,17 @@ namespace own {
             other.tail = NULL;
         }
 
+        /**
+         * @brief Appends an expiring list to the end of the current list, taking
+         * over its nodes.
+         *
+         * Complexity: O(1), if both lists share the allocator
+         * Complexity: O(m), otherwise, as elements are copied
+         *
+         * @param other The list to be appended.
+         */
+        inline void append(List<T, Allocator>&& other) { this->append(other); }
+
         /**
          * @brief This function slices off a portion of the current list and returns
          * it as a new list.
@@ -1026,7 +2052,7 @@ namespace own {
          * @return The sliced portion of the list as a new list.
          * @tparam T The type of elements in the list.
          */
-        List<T> sliceOff(usize start, usize end) {
+        List<T, Allocator> sliceOff(usize start, usize end) {
             if (start >= this->_len) {
                 start = this->_len;
             }
@@ -1034,7 +2060,7 @@ namespace own {
                 end = this->_len;
             }
             if (start >= end) {
-                return List<T>();
+                return List<T, Allocator>(this->allocator);
             }
 
             details::Node<T>* startNode = this->atNode(start);
@@ -1045,19 +2071,26 @@ namespace own {
 
             if (backNode) {
                 backNode->setNext(nextNode);
+            } else {
+                this->head = nextNode;
             }
             if (nextNode) {
                 nextNode->setBack(backNode);
+            } else {
+                this->tail = backNode;
             }
 
             startNode->setBack(NULL);
             endNode->setNext(NULL);
 
-            List<T> extractedList;
+            // nodes keep belonging to the same allocator
+            List<T, Allocator> extractedList(this->allocator);
+
+            this->_len -= end - start;
 
             extractedList._len = end - start;
             extractedList.head = startNode;
-            extractedList._end = endNode;
+            extractedList.tail = endNode;
 
             return extractedList;
         }
@@ -1068,9 +2101,10 @@ namespace own {
          * Complexity: O(n)
          */
         void reverse() {
-            if (this->isEmpty()) {
+            if (this->empty()) {
                 return;
             }
+            this->record(&ListStats::reversals);
 
             // once reversed node, back is acting as next
             for (details::Node<T>* it = this->head; it; it = it->back()) {
@@ -1080,6 +2114,245 @@ namespace own {
             std::swap(this->head, this->tail);
         }
 
+        /**
+         * @brief Sorts the list in ascending order with operator<.
+         *
+         * Stable, see sort(Compare).
+         *
+         * Complexity: O(n log n)
+         */
+        void sort() {
+            this->sort([](const T& a, const T& b) { return a < b; });
+        }
+
+        /**
+         * @brief Sorts the list with a bottom-up merge sort, relinking the nodes.
+         *
+         * Nothing is allocated, copied or moved and iterators stay valid. Sorted
+         * runs of 1, 2, 4, ... nodes are kept in bins and merged as a binary counter
+         * is incremented, so the list is walked once and merged log n times.
+         *
+         * The sort is stable, equal elements keep their order.
+         *
+         * Complexity: O(n log n)
+         *
+         * @param less A callable taking two const references and returning true if
+         * the first one goes before the second.
+         * @throws Whatever less throws, no element is lost then but their order is
+         * unspecified.
+         * @tparam Compare The callable data-type
+         */
+        template <typename Compare>
+        void sort(Compare less) {
+            if (this->_len < 2) {
+                return;
+            }
+            this->record(&ListStats::sorts);
+
+            details::Node<T>* bins[sizeof(usize) * 8] = {NULL};
+            usize used = 0;
+
+            details::Node<T>* rest = this->head;
+            details::Node<T>* run = NULL;
+
+            try {
+                while (rest) {
+                    run = rest;
+                    rest = rest->next();
+                    run->setNext(NULL);
+
+                    usize i = 0;
+                    for (; i < used && bins[i]; i++) {
+                        // on a throw bins[i] keeps the nodes of both runs
+                        details::Node<T>* later = run;
+                        run = NULL;
+                        mergeRuns(bins[i], later, less);
+
+                        run = bins[i];
+                        bins[i] = NULL;
+                    }
+
+                    if (i == used) {
+                        used++;
+                    }
+                    bins[i] = run;
+                    run = NULL;
+                }
+
+                // higher bins hold the earlier elements
+                for (usize i = 1; i < used; i++) {
+                    details::Node<T>* later = bins[i - 1];
+                    bins[i - 1] = NULL;
+
+                    if (bins[i] == NULL) {
+                        bins[i] = later;
+                    } else if (later) {
+                        mergeRuns(bins[i], later, less);
+                    }
+                }
+            } catch (...) {
+                details::Node<T>* chain = concatRuns(run, rest);
+                for (usize i = 0; i < used; i++) {
+                    chain = concatRuns(bins[i], chain);
+                }
+
+                this->relink(chain);
+                throw;
+            }
+
+            this->relink(bins[used - 1]);
+        }
+
+        /**
+         * @brief Merges a sorted list into this sorted list, other is left empty.
+         *
+         * Stable, see merge(List&, Compare).
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to be merged.
+         */
+        void merge(List<T, Allocator>& other) {
+            this->merge(other, [](const T& a, const T& b) { return a < b; });
+        }
+
+        /**
+         * @brief Merges a sorted list into this sorted list, other is left empty.
+         *
+         * The nodes of other are relinked if both lists share the allocator,
+         * otherwise its values are moved. On ties the elements of this list go
+         * first.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to be merged, sorted by less as well.
+         * @param less A callable taking two const references and returning true if
+         * the first one goes before the second.
+         * @throws Whatever less throws, both lists stay sorted then.
+         * @tparam Compare The callable data-type
+         */
+        template <typename Compare>
+        void merge(List<T, Allocator>& other, Compare less) {
+            if (this == &other) {
+                return;
+            }
+
+            iterator pos = this->begin();
+
+            while (!other.empty()) {
+                iterator it = other.begin();
+                while (pos != this->end() && !less(*it, *pos)) {
+                    ++pos;
+                }
+
+                if (pos == this->end()) {
+                    this->splice(pos, other);
+                    return;
+                }
+
+                this->splice(pos, other, it);
+            }
+        }
+
+        /**
+         * @brief Removes the consecutive duplicates of a sorted list with
+         * operator==.
+         *
+         * Complexity: O(n)
+         *
+         * @return The number of elements that were removed.
+         */
+        usize uniqueSorted() {
+            return this->uniqueSorted([](const T& a, const T& b) { return a == b; });
+        }
+
+        /**
+         * @brief Removes the consecutive duplicates of a sorted list, the first
+         * element of every run of equal elements is kept.
+         *
+         * Complexity: O(n)
+         *
+         * @param equal A callable taking two const references and returning true if
+         * they are equal.
+         * @return The number of elements that were removed.
+         * @tparam Equal The callable data-type
+         */
+        template <typename Equal>
+        usize uniqueSorted(Equal equal) {
+            usize removed = 0;
+
+            details::Node<T>* it = this->head;
+            while (it && it->next()) {
+                details::Node<T>* next = it->next();
+
+                if (equal(it->value(), next->value())) {
+                    this->detach(next);
+                    this->destroyNode(next);
+                    removed++;
+                } else {
+                    it = next;
+                }
+            }
+
+            return removed;
+        }
+
+        /**
+         * @brief Inserts a value into a sorted list, after the elements equal to it.
+         *
+         * Complexity: O(1), if the value goes at the back
+         * Complexity: O(n), otherwise
+         *
+         * @param value The value to be inserted.
+         * @return A cursor to the new element.
+         */
+        inline iterator insertSorted(const T& value) {
+            return this->insertSorted(value,
+                                      [](const T& a, const T& b) { return a < b; });
+        }
+
+        /**
+         * @brief Moves a value into a sorted list, after the elements equal to it.
+         *
+         * Complexity: O(1), if the value goes at the back
+         * Complexity: O(n), otherwise
+         *
+         * @param value The value to be moved.
+         * @return A cursor to the new element.
+         */
+        inline iterator insertSorted(T&& value) {
+            return this->insertSorted(std::move(value),
+                                      [](const T& a, const T& b) { return a < b; });
+        }
+
+        /**
+         * @brief Inserts a value into a list sorted by less, after the elements
+         * equal to it.
+         *
+         * Complexity: O(1), if the value goes at the back
+         * Complexity: O(n), otherwise
+         *
+         * @param value The value to be inserted, copied or moved.
+         * @param less A callable taking two const references and returning true if
+         * the first one goes before the second.
+         * @return A cursor to the new element.
+         * @tparam U T, const T& or T&&
+         * @tparam Compare The callable data-type
+         */
+        template <typename U, typename Compare>
+        iterator insertSorted(U&& value, Compare less) {
+            if (this->tail == NULL || !less(value, this->tail->value())) {
+                return this->emplaceBefore(this->end(), std::forward<U>(value));
+            }
+
+            iterator pos = this->begin();
+            while (!less(value, *pos)) {
+                ++pos;
+            }
+
+            return this->emplaceBefore(pos, std::forward<U>(value));
+        }
+
         /**
          * @brief Clears the list by deleting all nodes and resetting the length and
          * head and tail pointers.
@@ -1090,7 +2363,7 @@ namespace own {
             details::Node<T>* it = this->head;
             while (it) {
                 details::Node<T>* next = it->next();
-                delete it;
+                this->destroyNode(it);
                 it = next;
             }
 
@@ -1106,7 +2379,7 @@ namespace own {
          *
          * @param other The list to swap with.
          */
-        void swap(List<T>& other) {
+        void swap(List<T, Allocator>& other) {
             if (this == &other) {
                 return;
             }
@@ -1114,6 +2387,44 @@ namespace own {
             std::swap(this->_len, other._len);
             std::swap(this->head, other.head);
             std::swap(this->tail, other.tail);
+            // nodes must go back to the allocator they came from
+            std::swap(this->allocator, other.allocator);
+        }
+
+        /**
+         * @brief Applies the given action to each element in the list.
+         *
+         * The action can be any callable that takes a const reference to the element,
+         * so lambdas can capture their context and be inlined.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The callable to apply to each element.
+         * @tparam Action The callable data-type
+         */
+        template <typename Action>
+        void forEach(Action action) const {
+            for (const details::Node<T>* it = this->head; it; it = it->next()) {
+                action(it->value());
+            }
+        }
+
+        /**
+         * @brief Applies the given action to each element in the list.
+         *
+         * The action can be any callable that takes a reference to the element, so
+         * lambdas can capture their context and be inlined.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The callable to apply to each element.
+         * @tparam Action The callable data-type
+         */
+        template <typename Action>
+        void forEach(Action action) {
+            for (details::Node<T>* it = this->head; it; it = it->next()) {
+                action(it->value());
+            }
         }
 
         /**
@@ -1176,13 +2487,48 @@ namespace own {
          *
          * @param action The function to apply to each element.
          */
-        template <typename Context>
         void forEach(void (*action)(T&)) {
             for (details::Node<T>* it = this->head; it; it = it->next()) {
                 action(it->value());
             }
         }
 
+        /**
+         * Folds the list by applying an action to each element.
+         * The action can be any callable taking two parameters: const T&, B&.
+         *
+         * @param action   The callable to be applied to each element.
+         * @param initial  The initial value for folding.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) const {
+            for (const details::Node<T>* it = this->head; it; it = it->next()) {
+                action(it->value(), initial);
+            }
+
+            return initial;
+        }
+
+        /**
+         * Folds the list by applying an action to each element.
+         * The action can be any callable taking two parameters: T&, B&.
+         *
+         * @param action   The callable to be applied to each element.
+         * @param initial  The initial value for folding.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) {
+            for (details::Node<T>* it = this->head; it; it = it->next()) {
+                action(it->value(), initial);
+            }
+
+            return initial;
+        }
+
         /**
          * Folds the list by applying an action function to each element.
          * The action function takes three parameters: const T&, B&, Context&.
@@ -1257,6 +2603,52 @@ namespace own {
             return initial;
         }
 
+        /**
+         * Applies a given action on a sliding window of size N over the elements of the
+         * current list. The action can be any callable that takes a pointer to the N
+         * elements of the window.
+         *
+         * Every element is written twice into a ring of 2N, so the window is always
+         * contiguous and nothing has to be shifted. To stream the results instead of
+         * collecting them, or to keep running aggregates, see sliding::forEach and
+         * sliding::fold in window.hpp.
+         *
+         * Complexity: O(n)
+         *
+         * @param action The callable to be applied on the sliding window.
+         * @return A list containing the results of applying the action on the sliding
+         * window.
+         * @tparam N The size of the sliding window.
+         * @tparam Action The callable data-type
+         */
+        template <usize N, typename Action>
+        List<std::decay_t<std::invoke_result_t<Action&, T*> > >
+        window(Action action) const {
+            List<std::decay_t<std::invoke_result_t<Action&, T*> > > result;
+            T window[2 * N];
+
+            usize slot = 0;
+            usize filled = 0;
+
+            for (const details::Node<T>* it = this->head; it; it = it->next()) {
+                window[slot] = it->value();
+                window[slot + N] = it->value();
+
+                if (++slot == N) {
+                    slot = 0;
+                }
+
+                if (filled + 1 < N) {
+                    filled++;
+                } else {
+                    // the oldest element sits where the next one goes
+                    result.pushBack(action(&window[slot]));
+                }
+            }
+
+            return result;
+        }
+
         /**
          * Applies a given action on a sliding window of size N over the elements of the
          * current list. The action is a function pointer that takes an array of size N
@@ -1270,27 +2662,60 @@ namespace own {
          */
         template <usize N, typename R>
         List<R> window(R (*action)(T[N])) const {
-            T window[N];
+            return this->window<N, R (*)(T*)>(action);
+        }
+
+        /**
+         * Applies a given action on a sliding window of size n over the elements of the
+         * current list. The action can be any callable that takes a pointer to the n
+         * elements of the window and n.
+         *
+         * As the fixed size window, it writes every element twice into a ring of 2n
+         * allocated once.
+         *
+         * Complexity: O(n)
+         *
+         * @param action The callable to be applied on the sliding window.
+         * @param n The size of the sliding window.
+         * @return A list containing the results of applying the action on the sliding
+         * window.
+         * @tparam Action The callable data-type
+         */
+        template <typename Action>
+        List<std::decay_t<std::invoke_result_t<Action&, T*, usize> > >
+        window(Action action, usize n) const {
+            List<std::decay_t<std::invoke_result_t<Action&, T*, usize> > > result;
+
+            if (n == 0) {
+                return result;
+            }
+
+            T* window = new T[2 * n];
 
-            const details::Node<T>* it = this->head;
-            usize i = 0;
+            usize slot = 0;
+            usize filled = 0;
 
-            List<R> result;
+            try {
+                for (const details::Node<T>* it = this->head; it; it = it->next()) {
+                    window[slot] = it->value();
+                    window[slot + n] = it->value();
 
-            while (it) {
-                if (N > 1) {
-                    std::memmove(&window[0], &window[1], sizeof(T) * (N - 1));
-                }
-                window[N - 1] = it->value();
+                    if (++slot == n) {
+                        slot = 0;
+                    }
 
-                if (i + 1 >= N) {
-                    result.pushBack(action(window));
+                    if (filled + 1 < n) {
+                        filled++;
+                    } else {
+                        result.pushBack(action(&window[slot], n));
+                    }
                 }
-
-                it = it->next();
-                i++;
+            } catch (...) {
+                delete[] window;
+                throw;
             }
 
+            delete[] window;
             return result;
         }
 
@@ -1300,34 +2725,14 @@ namespace own {
          * and returns a value of type R.
          *
          * @param action The function pointer to be applied on the sliding window.
+         * @param n The size of the sliding window.
          * @return A list containing the results of applying the action on the sliding
          * window.
          * @tparam R The return type of the action function.
          */
         template <typename R>
         List<R> window(R (*action)(T*, usize n), usize n) const {
-            T* window = new T[n];
-
-            const details::Node<T>* it = this->head;
-            usize i = 0;
-
-            List<R> result;
-
-            while (it) {
-                if (n > 1) {
-                    std::memmove(&window[0], &window[1], sizeof(T) * (n - 1));
-                }
-                window[n - 1] = it->value();
-
-                if (i + 1 >= n) {
-                    result.pushBack(action(window, n));
-                }
-
-                it = it->next();
-                i++;
-            }
-
-            return result;
+            return this->window<R (*)(T*, usize)>(action, n);
         }
 
         /**
@@ -1364,8 +2769,11 @@ namespace own {
          * @param other The list to concatenate with.
          * @return A new list that contains elements from both lists.
          */
-        List<T> operator+(const List<T>& other) const {
-            List<T> newList;
+        List<T, Allocator> operator+(const List<T, Allocator>& other) const& {
+            this->recordCopy();
+            other.recordCopy();
+
+            List<T, Allocator> newList;
 
             for (const details::Node<T>* it = this->head; it; it = it->next()) {
                 newList.pushBack(it->value());
@@ -1377,6 +2785,53 @@ namespace own {
             return newList;
         }
 
+        /**
+         * @brief Concatenates an expiring list with another list, the nodes of this
+         * list are reused and the elements of other are copied.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The list to concatenate with.
+         * @return A new list that contains elements from both lists.
+         */
+        List<T, Allocator> operator+(const List<T, Allocator>& other) && {
+            *this += other;
+            return std::move(*this);
+        }
+
+        /**
+         * @brief Concatenates this list with an expiring list, the nodes of other
+         * are reused and the elements of this list are copied in front.
+         *
+         * Complexity: O(n), if both lists share the allocator
+         *
+         * @param other The list to concatenate with.
+         * @return A new list that contains elements from both lists.
+         */
+        List<T, Allocator> operator+(List<T, Allocator>&& other) const& {
+            List<T, Allocator> newList(*this);
+            newList.append(other);
+            return newList;
+        }
+
+        /**
+         * @brief Concatenates two expiring lists by relinking the nodes of other
+         * after the ones of this list.
+         *
+         * Usage:
+         *
+         *     own::List<int> merged = std::move(a) + std::move(b);
+         *
+         * Complexity: O(1), if both lists share the allocator
+         *
+         * @param other The list to concatenate with.
+         * @return A new list that contains elements from both lists.
+         */
+        List<T, Allocator> operator+(List<T, Allocator>&& other) && {
+            this->append(other);
+            return std::move(*this);
+        }
+
         /**
          * @brief Appends the elements of another list to this list.
          *
@@ -1385,7 +2840,9 @@ namespace own {
          * @param other The list to append.
          * @return A reference to this list after the append operation.
          */
-        List<T>& operator+=(const List<T>& other) {
+        List<T, Allocator>& operator+=(const List<T, Allocator>& other) {
+            other.recordCopy();
+
             for (const details::Node<T>* it = other.head; it; it = it->next()) {
                 this->pushBack(it->value());
             }
@@ -1393,6 +2850,19 @@ namespace own {
             return *this;
         }
 
+        /**
+         * @brief Appends an expiring list to this list, taking over its nodes.
+         *
+         * Complexity: O(1), if both lists share the allocator
+         *
+         * @param other The list to append.
+         * @return A reference to this list after the append operation.
+         */
+        List<T, Allocator>& operator+=(List<T, Allocator>&& other) {
+            this->append(other);
+            return *this;
+        }
+
         /**
          * @brief Overloads the equality operator to check if two lists are equal.
          *
@@ -1401,7 +2871,7 @@ namespace own {
          * @param other The list to compare with.
          * @return True if the lists are equal, false otherwise.
          */
-        bool operator==(const List<T>& other) const {
+        bool operator==(const List<T, Allocator>& other) const {
             if (this == &other) {
                 return true;
             }
@@ -1433,7 +2903,9 @@ namespace own {
          * @param other The list to compare with.
          * @return True if the lists are not equal, false otherwise.
          */
-        bool operator!=(const List<T> other) const { return !(this == other); }
+        bool operator!=(const List<T, Allocator>& other) const {
+            return !(*this == other);
+        }
 
         /**
          * @brief Overloads the assignment operator to assign the content of another
@@ -1442,32 +2914,47 @@ namespace own {
          * Complexity: O(n)
          *
          * @param other The list to assign from.
+         * @return A reference to this list.
+         * @throws Whatever copying an element or the allocator throws, the list is
+         * left unchanged then.
          */
-        void operator=(const List<T>& other) {
+        List<T, Allocator>& operator=(const List<T, Allocator>& other) {
             if (this == &other) {
-                return;
+                return *this;
             }
 
-            this->clear();
-
-            this->_len = other._len;
+            // copy and swap, this list is only changed once every copy succeeded
+            List<T, Allocator> copy(this->allocator);
+            copy.copyNodes(other);
 
-            details::Node<T>* previous = NULL;
+            usize before = this->_len;
+            this->swap(copy);
 
-            for (const details::Node<T>* it = other.head; it; it = it->next()) {
-                details::Node<T>* current = new details::Node<T>(it->value());
+            // the nodes were allocated by copy and the old ones are freed by it
+            this->record(&ListStats::allocations, this->_len);
+            this->record(&ListStats::frees, before);
+            this->recordPushes(this->_len);
+            other.recordCopy();
 
-                if (previous) {
-                    current->setBack(previous);
-                    previous->setNext(current);
-                } else {
-                    this->head = current;
-                }
+            return *this;
+        }
 
-                previous = current;
+        /**
+         * @brief Overloads the move assignment operator to take over the nodes of
+         * another list, which is left empty.
+         *
+         * Complexity: O(n), as the current nodes are freed
+         *
+         * @param other The list to move from.
+         * @return A reference to this list.
+         */
+        List<T, Allocator>& operator=(List<T, Allocator>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->swap(other);
             }
 
-            this->tail = previous;
+            return *this;
         }
 
         /**
@@ -1480,7 +2967,8 @@ namespace own {
          * @param list The list to print.
          * @return The output stream after printing the list.
          */
-        friend std::ostream& operator<<(std::ostream& out, const List<T>& list) {
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const List<T, Allocator>& list) {
             out << '[';
 
             if (list.len() > 0) {
@@ -1502,40 +2990,11 @@ namespace own {
          * Complexity: O(n)
          *
          * @param in The input stream.
-         * @param list The list to print.
+         * @param list The list to fill.
          * @return The input stream.
          */
-        friend std::istream& operator>>(std::istream& in, List<T>& list) {
-            char ch = 0;
-            in >> ch;
-
-            if (in.fail() || ch != '[') {
-                in.setstate(std::ios_base::failbit);
-                return in;
-            }
-
-            in >> ch;
-            if (in.fail() || ch == ']') {
-                return in;
-            }
-
-            for (; ch == ',' && in.good(); in >> ch) {
-                T value;
-                in >> value;
-
-                if (in.good()) {
-                    list.pushBack(value);
-                }
-            }
-
-            in >> ch;
-
-            if (in.fail() || ch != '[') {
-                in.setstate(std::ios_base::failbit);
-                return in;
-            }
-
-            return in;
+        friend std::istream& operator>>(std::istream& in, List<T, Allocator>& list) {
+            return details::readSequence<T>(in, list);
         }
 
       private:
@@ -1559,9 +3018,12 @@ namespace own {
             }
 
             // choose what's the shortest path
+            this->record(&ListStats::walks);
             if (at <= this->_len / 2) {
+                this->record(&ListStats::walkSteps, at);
                 return *this->head + at;
             } else {
+                this->record(&ListStats::walkSteps, this->_len - at - 1);
                 return *this->tail - (this->_len - at - 1);
             }
         }
@@ -1586,9 +3048,12 @@ namespace own {
             }
 
             // choose what's the shortest path
+            this->record(&ListStats::walks);
             if (at <= this->_len / 2) {
+                this->record(&ListStats::walkSteps, at);
                 return *this->head + at;
             } else {
+                this->record(&ListStats::walkSteps, this->_len - at - 1);
                 return *this->tail - (this->_len - at - 1);
             }
         }
@@ -1631,37 +3096,371 @@ namespace own {
          *
          * ------------------------------------------------
          *
-         * @param value The value to insert.
          * @param at The index at which to insert the new node.
          * @param backwarded Determines whether to insert the new node before or after
          the
          * specified index.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return The new node.
          */
-        void insert(T value, usize at, bool backwarded) {
+        template <typename... Args>
+        details::Node<T>* insert(usize at, bool backwarded, Args&&... args) {
             if (at == 0 && backwarded) {
-                this->pushFront(value);
-                return;
-            }
-            if (at >= this->_len) {
-                this->pushBack(value);
-                return;
+                this->emplaceFront(std::forward<Args>(args)...);
+                return this->head;
             }
-            if (at == this->_len - 1 && !backwarded) {
-                this->pushBack(value);
-                return;
+            if (at >= this->_len || (at == this->_len - 1 && !backwarded)) {
+                this->emplaceBack(std::forward<Args>(args)...);
+                return this->tail;
             }
 
             details::Node<T>* node = this->atNode(at);
+            details::Node<T>* created =
+                this->createNode(NULL, NULL, std::forward<Args>(args)...);
+
             if (backwarded) {
-                node->linkBack(new details::Node<T>(value));
+                node->linkBack(created);
             } else {
-                node->linkNext(new details::Node<T>(value));
+                node->linkNext(created);
             }
 
             this->_len++;
+            this->recordPushes(1);
+
+            return created;
+        }
+
+        /**
+         * @brief Adds n to a counter of stats, it compiles to nothing unless
+         * OWN_LIST_STATS is defined.
+         *
+         * Complexity: O(1)
+         */
+        inline void record(usize ListStats::*counter, usize n = 1) const {
+#ifdef OWN_LIST_STATS
+            this->_stats.*counter += n;
+#else
+            (void)counter;
+            (void)n;
+#endif
+        }
+
+        /**
+         * @brief Records that n elements were added, after the length was updated.
+         *
+         * Complexity: O(1)
+         */
+        inline void recordPushes(usize n) {
+            this->record(&ListStats::pushes, n);
+            this->recordPeak();
+        }
+
+        /**
+         * @brief Records that every element of this list is being copied into
+         * another list.
+         *
+         * Complexity: O(1)
+         */
+        inline void recordCopy() const {
+            this->record(&ListStats::copies);
+            this->record(&ListStats::copiedElements, this->_len);
+        }
+
+        /**
+         * @brief Records the length if it's the largest so far.
+         *
+         * Complexity: O(1)
+         */
+        inline void recordPeak() {
+#ifdef OWN_LIST_STATS
+            if (this->_len > this->_stats.peakLen) {
+                this->_stats.peakLen = this->_len;
+            }
+#endif
+        }
+
+        /**
+         * @brief Allocates and constructs a new node.
+         *
+         * Complexity: O(1)
+         *
+         * @param back The previous node.
+         * @param next The next node.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A pointer to the new node.
+         */
+        template <typename... Args>
+        inline details::Node<T>* createNode(details::Node<T>* back,
+                                            details::Node<T>* next, Args&&... args) {
+            details::Node<T>* storage = this->allocator.allocate();
+            this->record(&ListStats::allocations);
+
+            try {
+                return new (storage) details::Node<T>(std::in_place, back, next,
+                                                      std::forward<Args>(args)...);
+            } catch (...) {
+                this->allocator.deallocate(storage);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Appends a copy of every element of other to this empty list.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to be copied.
+         * @throws Whatever copying an element or the allocator throws, the list is
+         * left empty then.
+         */
+        void copyNodes(const List<T, Allocator>& other) {
+            try {
+                for (const details::Node<T>* it = other.head; it; it = it->next()) {
+                    details::Node<T>* current =
+                        this->createNode(this->tail, NULL, it->value());
+
+                    if (this->tail) {
+                        this->tail->setNext(current);
+                    } else {
+                        this->head = current;
+                    }
+
+                    this->tail = current;
+                    this->_len++;
+                }
+            } catch (...) {
+                this->clear();
+                throw;
+            }
+        }
+
+        /**
+         * @brief Destroys a node and gives its storage back to the allocator.
+         *
+         * Complexity: O(1)
+         *
+         * @param node The node to be destroyed.
+         */
+        inline void destroyNode(details::Node<T>* node) {
+            node->~Node();
+            this->allocator.deallocate(node);
+            this->record(&ListStats::frees);
+        }
+
+        /**
+         * @brief Makes node the new head after count front nodes were destroyed.
+         *
+         * Complexity: O(1)
+         */
+        inline void popFrontDetached(details::Node<T>* node, usize count) {
+            this->head = node;
+            if (node) {
+                node->setBack(NULL);
+            } else {
+                this->tail = NULL;
+            }
+            this->_len -= count;
+            this->record(&ListStats::pops, count);
+        }
+
+        /**
+         * @brief Makes node the new tail after count back nodes were destroyed.
+         *
+         * Complexity: O(1)
+         */
+        inline void popBackDetached(details::Node<T>* node, usize count) {
+            this->tail = node;
+            if (node) {
+                node->setNext(NULL);
+            } else {
+                this->head = NULL;
+            }
+            this->_len -= count;
+            this->record(&ListStats::pops, count);
+        }
+
+        /**
+         * @brief Unlinks a node of this list, keeping head, tail and length updated.
+         *
+         * Complexity: O(1)
+         *
+         * @param node The node to be unlinked, it's not destroyed.
+         */
+        void detach(details::Node<T>* node) {
+            if (node == this->head) {
+                this->head = node->next();
+            }
+            if (node == this->tail) {
+                this->tail = node->back();
+            }
+
+            node->unlink();
+            this->_len--;
+            this->record(&ListStats::pops);
+        }
+
+        /**
+         * @brief Merges two sorted runs linked through next only, on ties the
+         * elements of first go first.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param first The earlier run, set to the merged run. If less throws, it's
+         * set to a chain of every node of both runs.
+         * @param second The later run.
+         * @param less The comparison.
+         */
+        template <typename Compare>
+        static void mergeRuns(details::Node<T>*& first, details::Node<T>* second,
+                              Compare& less) {
+            details::Node<T>* a = first;
+            details::Node<T>* b = second;
+            details::Node<T>* last = NULL;
+
+            try {
+                if (a == NULL || b == NULL) {
+                    first = a ? a : b;
+                    return;
+                }
+
+                if (less(b->value(), a->value())) {
+                    first = b;
+                    b = b->next();
+                } else {
+                    a = a->next();
+                }
+                last = first;
+
+                while (a && b) {
+                    if (less(b->value(), a->value())) {
+                        last->setNext(b);
+                        last = b;
+                        b = b->next();
+                    } else {
+                        last->setNext(a);
+                        last = a;
+                        a = a->next();
+                    }
+                }
+            } catch (...) {
+                details::Node<T>* rest = concatRuns(a, b);
+                if (last) {
+                    last->setNext(rest);
+                } else {
+                    first = rest;
+                }
+                throw;
+            }
+
+            last->setNext(a ? a : b);
+        }
+
+        /**
+         * @brief Links a chain linked through next only in front of another.
+         *
+         * Complexity: O(n), where n is the length of first
+         *
+         * @return The joined chain.
+         */
+        static details::Node<T>* concatRuns(details::Node<T>* first,
+                                            details::Node<T>* second) {
+            if (first == NULL) {
+                return second;
+            }
+
+            details::Node<T>* last = first;
+            while (last->next()) {
+                last = last->next();
+            }
+            last->setNext(second);
+
+            return first;
+        }
+
+        /**
+         * @brief Rebuilds the back links, head and tail from a chain of every node
+         * of the list linked through next only.
+         *
+         * Complexity: O(n)
+         */
+        void relink(details::Node<T>* chain) {
+            details::Node<T>* back = NULL;
+            for (details::Node<T>* it = chain; it; it = it->next()) {
+                it->setBack(back);
+                back = it;
+            }
+
+            this->head = chain;
+            this->tail = back;
+        }
+
+        /**
+         * @brief Calls found with the index of every element equal to any of the
+         * given values, indexing the values first unless there are few elements.
+         *
+         * Complexity: O(n + m), if T is hashable
+         * Complexity: O(n log m + m log m), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         */
+        template <typename Found>
+        void matchAny(const List<T, Allocator>& values, Found found) const {
+            if constexpr (details::ValueSet<T>::supported) {
+                if (this->_len >= VALUE_SET_MIN_QUERIES) {
+                    details::ValueSet<T> set(values.begin(), values.end(), values._len);
+
+                    usize at = 0;
+                    for (details::Node<T>* it = this->head; it; it = it->next()) {
+                        if (set.has(it->value())) {
+                            found(at);
+                        }
+                        at++;
+                    }
+
+                    return;
+                }
+            }
+
+            usize at = 0;
+            for (details::Node<T>* it = this->head; it; it = it->next()) {
+                if (values.contains(it->value())) {
+                    found(at);
+                }
+                at++;
+            }
+        }
+
+        /**
+         * @brief Unlinks and destroys every node whose value matches the predicate.
+         *
+         * Complexity: O(n)
+         *
+         * @param remove A callable that returns true if the element must be removed.
+         * @return The number of elements that were removed.
+         */
+        template <typename Predicate>
+        usize eraseWhere(Predicate remove) {
+            usize oldLen = this->_len;
+
+            details::Node<T>* it = this->head;
+            while (it) {
+                details::Node<T>* next = it->next();
+
+                if (remove(it->value())) {
+                    this->detach(it);
+                    this->destroyNode(it);
+                }
+
+                it = next;
+            }
+
+            return oldLen - this->_len;
         }
 
       private:
+        /**
+         * @brief The allocator used for the nodes.
+         */
+        NodeAllocator allocator;
         /**
          * @brief The length of the list.
          */
@@ -1674,6 +3473,12 @@ namespace own {
          * @brief Pointer to the tail node of the list.
          */
         details::Node<T>* tail;
+#ifdef OWN_LIST_STATS
+        /**
+         * @brief The counters behind stats, mutable so lookups can count walks.
+         */
+        mutable ListStats _stats;
+#endif
     };
 
 } // namespace own
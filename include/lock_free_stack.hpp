@@ -0,0 +1,429 @@
+#ifndef LOCK_FREE_STACK_GUARD_HEADER
+#define LOCK_FREE_STACK_GUARD_HEADER
+
+#include "list.hpp"
+#include "pool.hpp"
+
+// std::atomic
+#include <atomic>
+// assert
+#include <cassert>
+// std::uint64_t and std::uintptr_t
+#include <cstdint>
+// std::move and std::forward
+#include <utility>
+// placement new
+#include <new>
+
+namespace own {
+
+    namespace details {
+
+        /**
+         * @brief A Treiber stack of nodes, the building block of LockFreeStack.
+         *
+         * The top pointer is packed with a tag in a single 64 bit word, the tag
+         * changes on every update so a pop that read a node which was popped and
+         * pushed back in the meantime (the ABA problem) fails its compare and swap.
+         *
+         * Popped nodes may still be read by a late pop, so they must never be freed
+         * while the stack is in use, only recycled.
+         *
+         * @note On 64 bit targets the pointer takes the low 48 bits, as user space
+         * addresses do on x86-64 and AArch64, which leaves 16 bits for the tag. A pop
+         * is only fooled if it stalls for exactly a multiple of 65536 updates. Builds
+         * without NDEBUG assert that every packed pointer reads back unchanged, which
+         * fails on targets with wider addresses, such as 5-level paging.
+         *
+         * @tparam Node The node type, it must have a `std::atomic<Node*> next`.
+         */
+        template <typename Node>
+        class TaggedStack {
+            static_assert(sizeof(void*) <= 8, "pointers must fit in a 64 bit word");
+
+          public:
+            /**
+             * @brief Constructs an empty stack.
+             *
+             * Complexity: O(1)
+             */
+            TaggedStack() : top(0) {}
+
+            /**
+             * @brief Checks if the stack is empty.
+             *
+             * Complexity: O(1)
+             *
+             * @return True if the stack is empty, it may be outdated as soon as it's
+             * returned if other threads are using the stack.
+             */
+            inline bool empty() const {
+                return pointer(this->top.load(std::memory_order_relaxed)) == NULL;
+            }
+
+            /**
+             * @brief Pushes a chain of nodes already linked from first to last.
+             *
+             * Complexity: O(1), lock-free
+             *
+             * @param first The node that becomes the top.
+             * @param last The node that gets linked to the previous top.
+             */
+            void pushChain(Node* first, Node* last) {
+                std::uint64_t old = this->top.load(std::memory_order_relaxed);
+
+                do {
+                    last->next.store(pointer(old), std::memory_order_relaxed);
+                } while (!this->top.compare_exchange_weak(old, pack(first, tag(old) + 1),
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed));
+            }
+
+            /**
+             * @brief Pops the top node.
+             *
+             * Complexity: O(1), lock-free
+             *
+             * @return The node, NULL if the stack was empty.
+             */
+            Node* pop() {
+                std::uint64_t old = this->top.load(std::memory_order_acquire);
+
+                for (;;) {
+                    Node* node = pointer(old);
+                    if (node == NULL) {
+                        return NULL;
+                    }
+
+                    // node may be popped and reused meanwhile, then the tag tells
+                    Node* next = node->next.load(std::memory_order_relaxed);
+                    if (this->top.compare_exchange_weak(old, pack(next, tag(old) + 1),
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_acquire)) {
+                        return node;
+                    }
+                }
+            }
+
+            /**
+             * @brief Detaches every node at once.
+             *
+             * Complexity: O(1), lock-free
+             *
+             * @return The former top, its chain ends with NULL and belongs to the
+             * caller.
+             */
+            Node* popAll() {
+                std::uint64_t old = this->top.load(std::memory_order_relaxed);
+
+                while (!this->top.compare_exchange_weak(old, pack(NULL, tag(old) + 1),
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_relaxed)) {
+                }
+
+                return pointer(old);
+            }
+
+          private:
+            /**
+             * @brief Bits of the word taken by the pointer.
+             */
+            static const unsigned POINTER_BITS = sizeof(void*) == 8 ? 48 : 32;
+            /**
+             * @brief Mask of the pointer bits.
+             */
+            static const std::uint64_t POINTER_MASK =
+                (std::uint64_t(1) << POINTER_BITS) - 1;
+
+            static inline std::uint64_t pack(Node* node, std::uint64_t tag) {
+                std::uint64_t address = std::uintptr_t(node);
+                std::uint64_t word = address | (tag << POINTER_BITS);
+                assert(pointer(word) == node && "pointer does not fit in POINTER_BITS");
+                return word;
+            }
+            static inline Node* pointer(std::uint64_t word) {
+                return reinterpret_cast<Node*>(std::uintptr_t(word & POINTER_MASK));
+            }
+            static inline std::uint64_t tag(std::uint64_t word) {
+                return word >> POINTER_BITS;
+            }
+
+          private:
+            /**
+             * @brief The top node and the tag, packed.
+             */
+            std::atomic<std::uint64_t> top;
+
+            static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                          "64 bit compare and swap is required");
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A lock-free stack for many threads, meant as a shared free list or work
+     * pool.
+     *
+     * It's a Treiber stack with tagged pointers (see details::TaggedStack).
+     * Nodes are carved out of chunks and recycled through a second lock-free free
+     * list, so once the stack has grown enough push and pop never call the global
+     * allocator, and the chunks are only released by the destructor.
+     *
+     * It speaks the same vocabulary as Stack, but pop is spelled tryPop since
+     * another thread may empty the stack at any time, and there is no top() nor
+     * len(), the top may be popped while being read and a counter would add a
+     * second contended word.
+     *
+     * @tparam T The type of the elements.
+     */
+    template <typename T>
+    class LockFreeStack {
+      public:
+        /**
+         * @brief Constructs an empty stack.
+         *
+         * Complexity: O(1)
+         *
+         * @param chunkLen How many nodes are allocated at once when the free list
+         * runs out.
+         */
+        explicit LockFreeStack(usize chunkLen = POOL_CHUNK_LEN) : chunks(NULL) {
+            this->chunkLen = chunkLen > 0 ? chunkLen : 1;
+        }
+
+        /**
+         * @brief Destructor, the remaining elements are destroyed.
+         *
+         * Complexity: O(n)
+         *
+         * @note No thread may be using the stack anymore.
+         */
+        ~LockFreeStack() {
+            Node* it = this->items.popAll();
+            while (it) {
+                it->value()->~T();
+                it = it->next.load(std::memory_order_relaxed);
+            }
+
+            Node* chunk = this->chunks.load(std::memory_order_relaxed);
+            while (chunk) {
+                Node* next = chunk->next.load(std::memory_order_relaxed);
+                delete[] chunk;
+                chunk = next;
+            }
+        }
+
+        /**
+         * @brief Checks if the stack is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the stack is empty, it may be outdated as soon as it's
+         * returned if other threads are using the stack.
+         */
+        inline bool empty() const { return this->items.empty(); }
+
+        /**
+         * @brief Constructs an element in place on top of the stack.
+         *
+         * Complexity: O(1), lock-free, amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @throws std::bad_alloc if a new chunk is needed and cannot be allocated.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args) {
+            Node* node = this->acquire();
+
+            try {
+                new (node->value()) T(std::forward<Args>(args)...);
+            } catch (...) {
+                this->free.pushChain(node, node);
+                throw;
+            }
+
+            this->items.pushChain(node, node);
+        }
+
+        /**
+         * @brief Pushes an element on top of the stack.
+         *
+         * Complexity: O(1), lock-free, amortized
+         *
+         * @param value The value to be pushed.
+         * @throws std::bad_alloc if a new chunk is needed and cannot be allocated.
+         */
+        inline void push(const T& value) { this->emplace(value); }
+
+        /**
+         * @brief Moves an element on top of the stack.
+         *
+         * Complexity: O(1), lock-free, amortized
+         *
+         * @param value The value to be moved.
+         * @throws std::bad_alloc if a new chunk is needed and cannot be allocated.
+         */
+        inline void push(T&& value) { this->emplace(std::move(value)); }
+
+        /**
+         * @brief Removes the top element of the stack, unless it's empty.
+         *
+         * Complexity: O(1), lock-free
+         *
+         * @param out Where the value of the element is moved to.
+         * @return True if an element was popped, false if the stack was empty.
+         */
+        bool tryPop(T& out) {
+            Node* node = this->items.pop();
+            if (node == NULL) {
+                return false;
+            }
+
+            try {
+                out = std::move(*node->value());
+            } catch (...) {
+                this->items.pushChain(node, node);
+                throw;
+            }
+
+            node->value()->~T();
+            this->free.pushChain(node, node);
+
+            return true;
+        }
+
+        /**
+         * @brief Detaches every element with a single compare and swap.
+         *
+         * Complexity: O(n), lock-free, only the detaching is shared with other
+         * threads
+         *
+         * @return A list with the elements from the top to the bottom.
+         * @throws std::bad_alloc if the list cannot grow, the elements not moved yet
+         * are pushed back.
+         */
+        List<T> popAll() {
+            List<T> list;
+
+            Node* first = this->items.popAll();
+            if (first == NULL) {
+                return list;
+            }
+
+            Node* it = first;
+            Node* last = NULL;
+            try {
+                while (it) {
+                    list.pushBack(std::move(*it->value()));
+                    it->value()->~T();
+                    last = it;
+                    it = it->next.load(std::memory_order_relaxed);
+                }
+            } catch (...) {
+                this->restore(first, last, it);
+                throw;
+            }
+
+            this->free.pushChain(first, last);
+            return list;
+        }
+
+      private:
+        /**
+         * @brief A node of either stack, or the header of a chunk when it's the first
+         * of one.
+         */
+        struct Node {
+            std::atomic<Node*> next;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            inline T* value() { return reinterpret_cast<T*>(this->storage); }
+        };
+
+        /**
+         * @brief Takes a node from the free list, allocating a new chunk if it's
+         * empty.
+         *
+         * The rest of a new chunk is pushed on the free list with a single compare
+         * and swap.
+         *
+         * Complexity: O(1), lock-free, amortized
+         *
+         * @return The node, its value is uninitialized.
+         * @throws std::bad_alloc if the chunk cannot be allocated.
+         */
+        Node* acquire() {
+            Node* node = this->free.pop();
+            if (node) {
+                return node;
+            }
+
+            Node* chunk = new Node[this->chunkLen + 1];
+
+            Node* old = this->chunks.load(std::memory_order_relaxed);
+            do {
+                chunk->next.store(old, std::memory_order_relaxed);
+            } while (!this->chunks.compare_exchange_weak(old, chunk,
+                                                         std::memory_order_relaxed));
+
+            for (usize i = 2; i < this->chunkLen; i++) {
+                chunk[i].next.store(&chunk[i + 1], std::memory_order_relaxed);
+            }
+            if (this->chunkLen > 1) {
+                this->free.pushChain(&chunk[2], &chunk[this->chunkLen]);
+            }
+
+            return &chunk[1];
+        }
+
+        /**
+         * @brief Recycles the nodes moved out by an interrupted popAll, and pushes
+         * the rest back.
+         *
+         * Complexity: O(n)
+         *
+         * @param first The first detached node.
+         * @param last The last node already moved out, NULL if none was.
+         * @param rest The first node not moved out.
+         */
+        void restore(Node* first, Node* last, Node* rest) {
+            if (last) {
+                this->free.pushChain(first, last);
+            }
+
+            Node* end = rest;
+            while (Node* next = end->next.load(std::memory_order_relaxed)) {
+                end = next;
+            }
+            this->items.pushChain(rest, end);
+        }
+
+        /**
+         * @brief Stacks cannot be copied.
+         */
+        LockFreeStack(const LockFreeStack<T>&) = delete;
+        void operator=(const LockFreeStack<T>&) = delete;
+
+      private:
+        /**
+         * @brief How many nodes are allocated at once.
+         */
+        usize chunkLen;
+        /**
+         * @brief Every allocated chunk, linked through their first node.
+         */
+        std::atomic<Node*> chunks;
+        /**
+         * @brief The elements, from the top.
+         */
+        alignas(CACHE_LINE_SIZE) details::TaggedStack<Node> items;
+        /**
+         * @brief The recycled nodes, the alignment also pads whatever follows the
+         * stack off its line.
+         */
+        alignas(CACHE_LINE_SIZE) details::TaggedStack<Node> free;
+    };
+
+} // namespace own
+
+#endif // LOCK_FREE_STACK_GUARD_HEADER
@@ -0,0 +1,1006 @@
+#ifndef MAPPED_LIST_GUARD_HEADER
+#define MAPPED_LIST_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::swap
+#include <algorithm>
+// std::ostream operator<< overloading
+#include <ostream>
+// std::istream operator>> overloading
+#include <istream>
+// std::runtime_error exception
+#include <stdexcept>
+// std::system_error and std::generic_category
+#include <system_error>
+// std::uint64_t
+#include <cstdint>
+// std::memcpy
+#include <cstring>
+// errno
+#include <cerrno>
+// std::is_trivially_copyable, std::enable_if and std::is_convertible
+#include <type_traits>
+// std::move and std::forward
+#include <utility>
+// std::bidirectional_iterator_tag and std::reverse_iterator
+#include <iterator>
+// ::open
+#include <fcntl.h>
+// ::mmap, ::munmap and ::msync
+#include <sys/mman.h>
+// ::fstat
+#include <sys/stat.h>
+// ::close and ::ftruncate
+#include <unistd.h>
+
+namespace own {
+
+    /**
+     * @brief Size of the mapping of a new MappedList, it doubles whenever the nodes
+     * don't fit.
+     */
+    const usize MAPPED_LIST_MIN_SIZE = 4096;
+
+    template <typename T>
+    class MappedList;
+
+    namespace details {
+
+        /**
+         * @brief A bidirectional iterator over a MappedList.
+         *
+         * It keeps the offset of the node rather than a pointer, so it stays valid
+         * when the mapping grows and moves.
+         *
+         * @tparam ListT MappedList<T> for a mutable iterator, const MappedList<T>
+         * otherwise.
+         * @tparam U T for a mutable iterator, const T otherwise.
+         */
+        template <typename ListT, typename U>
+        class MappedIterator {
+          public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef typename std::remove_const<U>::type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef U* pointer;
+            typedef U& reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            MappedIterator() : list(NULL), offset(0) {}
+
+            /**
+             * @brief Constructs an iterator pointing to a node.
+             *
+             * Complexity: O(1)
+             *
+             * @param list The list being iterated.
+             * @param offset The offset of the node, 0 for the end of the list.
+             */
+            MappedIterator(ListT* list, std::uint64_t offset)
+                : list(list), offset(offset) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename OtherList, typename OtherU,
+                      typename = typename std::enable_if<
+                          std::is_convertible<OtherList*, ListT*>::value &&
+                          std::is_convertible<OtherU*, U*>::value>::type>
+            MappedIterator(const MappedIterator<OtherList, OtherU>& other)
+                : list(other.list), offset(other.offset) {}
+
+            // Standard bidirectional iterator operations, all of them O(1).
+
+            inline reference operator*() const {
+                return this->list->nodeAt(this->offset)->value;
+            }
+            inline pointer operator->() const { return &**this; }
+
+            inline MappedIterator& operator++() {
+                this->offset = this->list->nodeAt(this->offset)->next;
+                return *this;
+            }
+            inline MappedIterator operator++(int) {
+                MappedIterator it = *this;
+                ++*this;
+                return it;
+            }
+            inline MappedIterator& operator--() {
+                this->offset = this->offset ? this->list->nodeAt(this->offset)->back
+                                            : this->list->header()->tail;
+                return *this;
+            }
+            inline MappedIterator operator--(int) {
+                MappedIterator it = *this;
+                --*this;
+                return it;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend inline bool operator==(const MappedIterator& a,
+                                          const MappedIterator& b) {
+                return a.offset == b.offset;
+            }
+            friend inline bool operator!=(const MappedIterator& a,
+                                          const MappedIterator& b) {
+                return a.offset != b.offset;
+            }
+
+          private:
+            template <typename, typename>
+            friend class MappedIterator;
+
+            /**
+             * @brief The list being iterated.
+             */
+            ListT* list;
+            /**
+             * @brief The offset of the current node, 0 past the end.
+             */
+            std::uint64_t offset;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A double-linked list whose nodes live in a memory mapped file, so it
+     * survives the process and is reopened without any parsing.
+     *
+     * Nodes are linked by their offset in the file instead of by pointer, which
+     * keeps them valid wherever the file gets mapped. Removed nodes are recycled
+     * through a free list, and the file doubles whenever it runs out of room.
+     *
+     * It provides what Queue and Stack need from their container:
+     *
+     *     own::Queue<Job, own::MappedList<Job> > backlog(
+     *         own::MappedList<Job>("backlog.bin"));
+     *
+     * @note Growing the file remaps it, which invalidates references to the elements
+     * but not iterators. Writes reach the file as the kernel sees fit, sync() forces
+     * them, and a crash in the middle of an update may leave the file inconsistent.
+     *
+     * @tparam T The type of the elements, it must be trivially copyable since the
+     * bytes are read back by another process.
+     */
+    template <typename T>
+    class MappedList {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "elements are stored as raw bytes, T must be trivially copyable");
+
+      public:
+        typedef details::MappedIterator<MappedList<T>, T> iterator;
+        typedef details::MappedIterator<const MappedList<T>, const T> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * @brief Constructs an empty list in anonymous memory, which is not backed
+         * by any file.
+         *
+         * Complexity: O(1)
+         *
+         * @throws std::system_error if the memory cannot be mapped.
+         */
+        MappedList() : fd(-1), base(NULL), size(0) { this->map(MAPPED_LIST_MIN_SIZE); }
+
+        /**
+         * @brief Opens the list stored in a file, creating an empty one if the file
+         * doesn't exist or is empty.
+         *
+         * Every offset of an existing file is checked against its size and both
+         * chains are walked once, so a truncated or corrupted file is rejected
+         * before any node is read through it.
+         *
+         * Complexity: O(n)
+         *
+         * @param path The path of the file.
+         * @throws std::system_error if the file cannot be opened or mapped.
+         * @throws std::runtime_error if the file holds something else than a list
+         * of nodes of this size, or if it's truncated or corrupted.
+         */
+        explicit MappedList(const char* path) : base(NULL), size(0) {
+            this->fd = ::open(path, O_RDWR | O_CREAT, 0644);
+            if (this->fd < 0) {
+                throw std::system_error(errno, std::generic_category(),
+                                        "MappedList: cannot open file");
+            }
+
+            try {
+                struct stat info;
+                if (::fstat(this->fd, &info) != 0) {
+                    throw std::system_error(errno, std::generic_category(),
+                                            "MappedList: cannot stat file");
+                }
+
+                usize existing = usize(info.st_size);
+                this->map(existing > 0 ? existing : MAPPED_LIST_MIN_SIZE);
+
+                if (existing > 0 && (this->header()->magic != MAGIC ||
+                                     this->header()->nodeSize != sizeof(Node))) {
+                    throw std::runtime_error("MappedList: not a list of this type");
+                }
+                if (existing > 0 && !this->consistent()) {
+                    throw std::runtime_error("MappedList: truncated or corrupted file");
+                }
+            } catch (...) {
+                this->unmap();
+                ::close(this->fd);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Move constructor, the mapping of other is taken over and other is
+         * left as an empty anonymous list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be moved.
+         */
+        MappedList(MappedList<T>&& other) : MappedList() { this->swap(other); }
+
+        /**
+         * @brief Destructor, the mapping is released and the file closed, the
+         * elements stay in the file.
+         *
+         * Complexity: O(1)
+         */
+        ~MappedList() {
+            this->unmap();
+            if (this->fd >= 0) {
+                ::close(this->fd);
+            }
+        }
+
+        /**
+         * @brief Checks if the list is backed by a file.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if a file was opened, false for anonymous memory.
+         */
+        inline bool isPersistent() const { return this->fd >= 0; }
+
+        /**
+         * @brief Checks if the list is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        inline bool empty() const { return this->header()->len == 0; }
+
+        /**
+         * @brief Returns the length of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the list.
+         */
+        inline usize len() const { return usize(this->header()->len); }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value, until the mapping grows.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& front() const {
+            return this->nodeAt(this->header()->head)->value;
+        }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value, until the mapping grows.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T& front() { return this->nodeAt(this->header()->head)->value; }
+
+        /**
+         * @brief Get the value of the back element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value, until the mapping grows.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& back() const { return this->nodeAt(this->header()->tail)->value; }
+
+        /**
+         * @brief Get the value of the back element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value, until the mapping grows.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T& back() { return this->nodeAt(this->header()->tail)->value; }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline iterator begin() { return iterator(this, this->header()->head); }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline const_iterator begin() const {
+            return const_iterator(this, this->header()->head);
+        }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline iterator end() { return iterator(this, 0); }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const { return const_iterator(this, 0); }
+
+        /**
+         * @brief Returns a const iterator to the first element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to cend() if the list is empty.
+         */
+        inline const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Insert a new element at the front of the list.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value of the new element.
+         * @throws std::system_error if the file cannot grow.
+         */
+        inline void pushFront(const T& value) { this->emplaceFront(value); }
+
+        /**
+         * @brief Constructs a new element at the front of the list.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element, until the mapping grows.
+         * @throws std::system_error if the file cannot grow.
+         */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            // args may live in the mapping, which moves if it has to grow
+            T value(std::forward<Args>(args)...);
+
+            std::uint64_t offset = this->allocateNode();
+            Header* header = this->header();
+            Node* node = this->nodeAt(offset);
+
+            node->back = 0;
+            node->next = header->head;
+            std::memcpy(&node->value, &value, sizeof(T));
+
+            if (header->head) {
+                this->nodeAt(header->head)->back = offset;
+            } else {
+                header->tail = offset;
+            }
+
+            header->head = offset;
+            header->len++;
+
+            return node->value;
+        }
+
+        /**
+         * @brief Adds an element to the end of the list.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         * @throws std::system_error if the file cannot grow.
+         */
+        inline void pushBack(const T& value) { this->emplaceBack(value); }
+
+        /**
+         * @brief Constructs a new element at the end of the list.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element, until the mapping grows.
+         * @throws std::system_error if the file cannot grow.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            // args may live in the mapping, which moves if it has to grow
+            T value(std::forward<Args>(args)...);
+
+            std::uint64_t offset = this->allocateNode();
+            Header* header = this->header();
+            Node* node = this->nodeAt(offset);
+
+            node->back = header->tail;
+            node->next = 0;
+            std::memcpy(&node->value, &value, sizeof(T));
+
+            if (header->tail) {
+                this->nodeAt(header->tail)->next = offset;
+            } else {
+                header->head = offset;
+            }
+
+            header->tail = offset;
+            header->len++;
+
+            return node->value;
+        }
+
+        /**
+         * @brief Removes and returns the first element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popFront() {
+            Header* header = this->header();
+            std::uint64_t offset = header->head;
+            Node* node = this->nodeAt(offset);
+            T value = node->value;
+
+            header->head = node->next;
+            if (header->head) {
+                this->nodeAt(header->head)->back = 0;
+            } else {
+                header->tail = 0;
+            }
+
+            header->len--;
+            this->releaseNode(offset);
+
+            return value;
+        }
+
+        /**
+         * @brief Removes and returns the last element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popBack() {
+            Header* header = this->header();
+            std::uint64_t offset = header->tail;
+            Node* node = this->nodeAt(offset);
+            T value = node->value;
+
+            header->tail = node->back;
+            if (header->tail) {
+                this->nodeAt(header->tail)->next = 0;
+            } else {
+                header->head = 0;
+            }
+
+            header->len--;
+            this->releaseNode(offset);
+
+            return value;
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this list, other is left
+         * empty.
+         *
+         * Complexity: O(m), as nodes cannot move between files
+         *
+         * @param other The list to be appended.
+         * @throws std::system_error if the file cannot grow.
+         */
+        void append(MappedList<T>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            while (!other.empty()) {
+                this->pushBack(other.front());
+                other.popFront();
+            }
+        }
+
+        /**
+         * @brief Reverses the order of the elements in the list.
+         *
+         * Complexity: O(n)
+         */
+        void reverse() {
+            Header* header = this->header();
+
+            for (std::uint64_t it = header->head; it;) {
+                Node* node = this->nodeAt(it);
+                std::swap(node->back, node->next);
+                // once reversed, back is acting as next
+                it = node->back;
+            }
+
+            std::swap(header->head, header->tail);
+        }
+
+        /**
+         * @brief Removes all elements, the file keeps its size for later pushes.
+         *
+         * Complexity: O(1)
+         */
+        void clear() {
+            Header* header = this->header();
+            header->head = 0;
+            header->tail = 0;
+            header->len = 0;
+            header->free = 0;
+            header->used = firstNode();
+        }
+
+        /**
+         * @brief Swaps the mappings, and so the files, of both lists.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to swap with.
+         */
+        void swap(MappedList<T>& other) {
+            std::swap(this->fd, other.fd);
+            std::swap(this->base, other.base);
+            std::swap(this->size, other.size);
+        }
+
+        /**
+         * @brief Writes the changes back to the file and waits for it.
+         *
+         * Complexity: O(n)
+         *
+         * @throws std::system_error if the mapping cannot be written.
+         */
+        void sync() {
+            if (this->fd >= 0 && ::msync(this->base, this->size, MS_SYNC) != 0) {
+                throw std::system_error(errno, std::generic_category(),
+                                        "MappedList::sync");
+            }
+        }
+
+        /**
+         * @brief Checks if both lists hold the same elements in the same order.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are equal, false otherwise.
+         */
+        bool operator==(const MappedList<T>& other) const {
+            if (this->len() != other.len()) {
+                return false;
+            }
+
+            for (const_iterator it = this->begin(), otherIt = other.begin();
+                 it != this->end(); ++it, ++otherIt) {
+                if (!(*it == *otherIt)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Checks if two lists are not equal.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are not equal, false otherwise.
+         */
+        inline bool operator!=(const MappedList<T>& other) const {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Moves the mapping of another list into this one, other is left as
+         * an empty anonymous list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to move from.
+         * @return A reference to this list.
+         */
+        MappedList<T>& operator=(MappedList<T>&& other) {
+            if (this != &other) {
+                MappedList<T> taken(std::move(other));
+                this->swap(taken);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the output stream operator to print the list as a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param list The list to print.
+         * @return The output stream after printing the list.
+         */
+        friend std::ostream& operator<<(std::ostream& out, const MappedList<T>& list) {
+            out << '[';
+
+            for (const_iterator it = list.begin(); it != list.end(); ++it) {
+                if (it != list.begin()) {
+                    out << ", ";
+                }
+                out << *it;
+            }
+
+            out << ']';
+            return out;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the list from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param list The list to fill.
+         * @return The input stream.
+         */
+        friend std::istream& operator>>(std::istream& in, MappedList<T>& list) {
+            return details::readSequence<T>(in, list);
+        }
+
+      private:
+        template <typename, typename>
+        friend class details::MappedIterator;
+
+        /**
+         * @brief The first bytes of the file.
+         */
+        struct Header {
+            /**
+             * @brief MAGIC, tells a list file apart from anything else.
+             */
+            std::uint64_t magic;
+            /**
+             * @brief sizeof(Node), tells lists of different types apart.
+             */
+            std::uint64_t nodeSize;
+            std::uint64_t head;
+            std::uint64_t tail;
+            std::uint64_t len;
+            /**
+             * @brief The first released node, linked through next.
+             */
+            std::uint64_t free;
+            /**
+             * @brief Where the never used space starts.
+             */
+            std::uint64_t used;
+        };
+
+        /**
+         * @brief A node, linked by offsets from the start of the file, 0 is none.
+         */
+        struct Node {
+            std::uint64_t back;
+            std::uint64_t next;
+            T value;
+        };
+
+        /**
+         * @brief "ownlist" and a format version.
+         */
+        static constexpr std::uint64_t MAGIC = 0x0174736c6e776fULL;
+
+        /**
+         * @brief Returns the offset of the first node, past the aligned header.
+         *
+         * Complexity: O(1)
+         */
+        static inline std::uint64_t firstNode() {
+            return (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+        }
+
+        inline Header* header() const { return reinterpret_cast<Header*>(this->base); }
+
+        inline Node* nodeAt(std::uint64_t offset) const {
+            return reinterpret_cast<Node*>(this->base + offset);
+        }
+
+        /**
+         * @brief Checks if an offset is the start of a node in the used space, as
+         * long as the used space itself ends at a node boundary.
+         *
+         * Complexity: O(1)
+         */
+        inline bool isNode(std::uint64_t offset) const {
+            return offset >= firstNode() && offset < this->header()->used &&
+                   (offset - firstNode()) % sizeof(Node) == 0;
+        }
+
+        /**
+         * @brief Checks the header against the size of the mapping, and that the
+         * chain of elements and the free list only link nodes of the used space.
+         *
+         * Complexity: O(n)
+         *
+         * @return False if any offset is out of place or a chain is broken.
+         */
+        bool consistent() const {
+            const Header* header = this->header();
+            if (header->used < firstNode() || header->used > this->size ||
+                (header->used - firstNode()) % sizeof(Node) != 0) {
+                return false;
+            }
+
+            // every walk is bounded by the amount of nodes, which also stops cycles
+            std::uint64_t nodes = (header->used - firstNode()) / sizeof(Node);
+            if (header->len > nodes || (header->head == 0) != (header->len == 0) ||
+                (header->tail == 0) != (header->len == 0)) {
+                return false;
+            }
+
+            std::uint64_t back = 0;
+            std::uint64_t offset = header->head;
+            for (std::uint64_t i = 0; i < header->len; i++) {
+                if (!this->isNode(offset) || this->nodeAt(offset)->back != back) {
+                    return false;
+                }
+                back = offset;
+                offset = this->nodeAt(offset)->next;
+            }
+            if (offset != 0 || back != header->tail) {
+                return false;
+            }
+
+            offset = header->free;
+            for (std::uint64_t i = header->len; offset != 0; i++) {
+                if (i >= nodes || !this->isNode(offset)) {
+                    return false;
+                }
+                offset = this->nodeAt(offset)->next;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Takes a node from the free list, or from the unused space growing
+         * the file if there's none left.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @return The offset of the node.
+         * @throws std::system_error if the file cannot grow.
+         */
+        std::uint64_t allocateNode() {
+            Header* header = this->header();
+            if (header->free) {
+                std::uint64_t offset = header->free;
+                header->free = this->nodeAt(offset)->next;
+                return offset;
+            }
+
+            if (header->used + sizeof(Node) > this->size) {
+                this->grow(this->size * 2);
+                header = this->header();
+            }
+
+            std::uint64_t offset = header->used;
+            header->used += sizeof(Node);
+            return offset;
+        }
+
+        /**
+         * @brief Gives a node back to the free list.
+         *
+         * Complexity: O(1)
+         */
+        inline void releaseNode(std::uint64_t offset) {
+            Header* header = this->header();
+            this->nodeAt(offset)->next = header->free;
+            header->free = offset;
+        }
+
+        /**
+         * @brief Maps size bytes of the file, or of anonymous memory, and writes an
+         * empty header if there's none.
+         *
+         * Complexity: O(1)
+         */
+        void map(usize size) {
+            if (size < firstNode() + sizeof(Node)) {
+                size = firstNode() + sizeof(Node);
+            }
+
+            void* memory;
+            if (this->fd >= 0) {
+                struct stat info;
+                if (::fstat(this->fd, &info) == 0 && usize(info.st_size) < size &&
+                    ::ftruncate(this->fd, off_t(size)) != 0) {
+                    throw std::system_error(errno, std::generic_category(),
+                                            "MappedList: cannot grow file");
+                }
+
+                memory = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                this->fd, 0);
+            } else {
+                memory = ::mmap(NULL, size, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            }
+
+            if (memory == MAP_FAILED) {
+                throw std::system_error(errno, std::generic_category(),
+                                        "MappedList: cannot map memory");
+            }
+
+            this->base = static_cast<unsigned char*>(memory);
+            this->size = size;
+
+            // a fresh file or anonymous memory reads as zeros
+            if (this->header()->magic == 0) {
+                Header* header = this->header();
+                header->magic = MAGIC;
+                header->nodeSize = sizeof(Node);
+                this->clear();
+            }
+        }
+
+        /**
+         * @brief Grows the mapping to size bytes, the nodes keep their offsets.
+         *
+         * Complexity: O(1), for a file
+         * Complexity: O(n), for anonymous memory, as it's copied
+         */
+        void grow(usize size) {
+            if (this->fd >= 0) {
+                unsigned char* old = this->base;
+                usize oldSize = this->size;
+
+                this->map(size);
+                ::munmap(old, oldSize);
+                return;
+            }
+
+            unsigned char* old = this->base;
+            usize oldSize = this->size;
+
+            this->map(size);
+            std::memcpy(this->base, old, oldSize);
+            ::munmap(old, oldSize);
+        }
+
+        /**
+         * @brief Releases the mapping.
+         *
+         * Complexity: O(1)
+         */
+        inline void unmap() {
+            if (this->base) {
+                ::munmap(this->base, this->size);
+                this->base = NULL;
+            }
+        }
+
+        /**
+         * @brief Lists cannot be copied, each one owns its file.
+         */
+        MappedList(const MappedList<T>&) = delete;
+        void operator=(const MappedList<T>&) = delete;
+
+        /**
+         * @brief The file, -1 for anonymous memory.
+         */
+        int fd;
+        /**
+         * @brief The start of the mapping, where the header is.
+         */
+        unsigned char* base;
+        /**
+         * @brief The size of the mapping, and of the file.
+         */
+        usize size;
+    };
+
+} // namespace own
+
+#endif // MAPPED_LIST_GUARD_HEADER
@@ -0,0 +1,375 @@
+#ifndef MPMC_QUEUE_GUARD_HEADER
+#define MPMC_QUEUE_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::atomic
+#include <atomic>
+// std::this_thread::yield
+#include <thread>
+// std::move and std::forward
+#include <utility>
+// placement new
+#include <new>
+
+namespace own {
+
+    /**
+     * @brief A bounded lock-free queue for many producers and many consumers.
+     *
+     * Every slot of the ring carries a sequence number telling whether it's ready
+     * to be written or read for the current lap, so producers and consumers only
+     * contend on their own index, each one on a separate cache line, and never
+     * take a lock.
+     *
+     * It speaks the same vocabulary as Queue, push and pop wait while the queue is
+     * full or empty, tryPush and tryPop give up instead. There is no front() since
+     * the element could be popped by another thread while being read.
+     *
+     * @note Moving T must not throw.
+     *
+     * @tparam T The type of the elements.
+     */
+    template <typename T>
+    class MpmcQueue {
+        static_assert(std::is_nothrow_move_constructible<T>::value &&
+                          std::is_nothrow_move_assignable<T>::value,
+                      "a claimed slot can't be given back, moving T must not throw");
+
+      public:
+        /**
+         * @brief Constructs an empty queue.
+         *
+         * Complexity: O(n)
+         *
+         * @param capacity How many elements fit, rounded up to a power of two and at
+         * least 2.
+         */
+        explicit MpmcQueue(usize capacity) {
+            capacity = details::nextPowerOfTwo(capacity < 2 ? 2 : capacity);
+
+            this->cells = new Cell[capacity];
+            this->mask = capacity - 1;
+
+            for (usize i = 0; i < capacity; i++) {
+                this->cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            this->enqueuePos.store(0, std::memory_order_relaxed);
+            this->dequeuePos.store(0, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Destructor, the remaining elements are destroyed.
+         *
+         * Complexity: O(n)
+         *
+         * @note No thread may be using the queue anymore.
+         */
+        ~MpmcQueue() {
+            usize end = this->enqueuePos.load(std::memory_order_relaxed);
+            for (usize pos = this->dequeuePos.load(std::memory_order_relaxed); pos != end;
+                 pos++) {
+                this->cells[pos & this->mask].value()->~T();
+            }
+
+            delete[] this->cells;
+        }
+
+        /**
+         * @brief Returns how many elements fit in the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The capacity of the queue.
+         */
+        inline usize capacity() const { return this->mask + 1; }
+
+        /**
+         * @brief Returns the number of elements in the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the queue, it may be outdated as soon as it's
+         * returned if other threads are using the queue.
+         */
+        usize len() const {
+            usize dequeued = this->dequeuePos.load(std::memory_order_relaxed);
+            usize enqueued = this->enqueuePos.load(std::memory_order_relaxed);
+
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the queue is empty, it may be outdated as soon as it's
+         * returned if other threads are using the queue.
+         */
+        inline bool empty() const { return this->len() == 0; }
+
+        /**
+         * @brief Constructs an element in place at the end of the queue, unless it's
+         * full.
+         *
+         * Complexity: O(1), lock-free
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return True if the element was pushed, false if the queue was full.
+         */
+        template <typename... Args>
+        bool tryEmplace(Args&&... args) {
+            if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value) {
+                // a claimed slot can't be given back, so nothing may throw past it
+                T value(std::forward<Args>(args)...);
+                return this->tryEmplace(std::move(value));
+            } else {
+                usize pos;
+                if (this->claim(this->enqueuePos, 0, 1, pos) == 0) {
+                    return false;
+                }
+
+                Cell& cell = this->cells[pos & this->mask];
+                new (cell.value()) T(std::forward<Args>(args)...);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+
+                return true;
+            }
+        }
+
+        /**
+         * @brief Adds an element to the end of the queue, unless it's full.
+         *
+         * Complexity: O(1), lock-free
+         *
+         * @param value The value to be added.
+         * @return True if the element was pushed, false if the queue was full.
+         */
+        inline bool tryPush(const T& value) { return this->tryEmplace(value); }
+
+        /**
+         * @brief Moves an element to the end of the queue, unless it's full.
+         *
+         * Complexity: O(1), lock-free
+         *
+         * @param value The value to be moved, it's untouched if the queue was full.
+         * @return True if the element was pushed, false if the queue was full.
+         */
+        inline bool tryPush(T&& value) { return this->tryEmplace(std::move(value)); }
+
+        /**
+         * @brief Removes the first element of the queue, unless it's empty.
+         *
+         * Complexity: O(1), lock-free
+         *
+         * @param out Where the value of the element is moved to.
+         * @return True if an element was popped, false if the queue was empty.
+         */
+        bool tryPop(T& out) {
+            usize pos;
+            if (this->claim(this->dequeuePos, 1, 1, pos) == 0) {
+                return false;
+            }
+
+            this->release(this->cells[pos & this->mask], pos, out);
+            return true;
+        }
+
+        /**
+         * @brief Moves up to count elements to the end of the queue, claiming all the
+         * free slots at once.
+         *
+         * Complexity: O(count), lock-free
+         *
+         * @param values The values to be moved, in order.
+         * @param count The amount of values.
+         * @return How many values were pushed, the first ones, 0 if the queue was
+         * full.
+         */
+        usize tryPushBatch(T* values, usize count) {
+            usize pos;
+            usize claimed = this->claim(this->enqueuePos, 0, count, pos);
+
+            for (usize i = 0; i < claimed; i++) {
+                Cell& cell = this->cells[(pos + i) & this->mask];
+                new (cell.value()) T(std::move(values[i]));
+                cell.sequence.store(pos + i + 1, std::memory_order_release);
+            }
+
+            return claimed;
+        }
+
+        /**
+         * @brief Removes up to max elements from the front of the queue, claiming all
+         * the ready slots at once.
+         *
+         * Complexity: O(max), lock-free
+         *
+         * @param out Where the values are moved to, in order.
+         * @param max The amount of values that fit in out.
+         * @return How many values were popped, 0 if the queue was empty.
+         */
+        usize tryPopBatch(T* out, usize max) {
+            usize pos;
+            usize claimed = this->claim(this->dequeuePos, 1, max, pos);
+
+            for (usize i = 0; i < claimed; i++) {
+                this->release(this->cells[(pos + i) & this->mask], pos + i, out[i]);
+            }
+
+            return claimed;
+        }
+
+        /**
+         * @brief Adds an element to the end of the queue, waiting while it's full.
+         *
+         * Complexity: O(1), if the queue is not full
+         *
+         * @param value The value to be added.
+         */
+        void push(const T& value) {
+            while (!this->tryEmplace(value)) {
+                std::this_thread::yield();
+            }
+        }
+
+        /**
+         * @brief Moves an element to the end of the queue, waiting while it's full.
+         *
+         * Complexity: O(1), if the queue is not full
+         *
+         * @param value The value to be moved.
+         */
+        void push(T&& value) {
+            while (!this->tryEmplace(std::move(value))) {
+                std::this_thread::yield();
+            }
+        }
+
+        /**
+         * @brief Removes and returns the first element of the queue, waiting while
+         * it's empty.
+         *
+         * Complexity: O(1), if the queue is not empty
+         *
+         * @return The value of the element.
+         */
+        T pop() {
+            usize pos = this->dequeuePos.fetch_add(1, std::memory_order_relaxed);
+            Cell* cell = &this->cells[pos & this->mask];
+
+            // the slot is ours, it only has to be written for this lap
+            while (cell->sequence.load(std::memory_order_acquire) != pos + 1) {
+                std::this_thread::yield();
+            }
+
+            T* ptr = cell->value();
+            T value = std::move(*ptr);
+            ptr->~T();
+
+            cell->sequence.store(pos + this->mask + 1, std::memory_order_release);
+            return value;
+        }
+
+      private:
+        /**
+         * @brief A slot of the ring and the lap it's ready for.
+         *
+         * sequence = pos means it can be written for pos, pos + 1 that it can be
+         * read for pos.
+         */
+        struct Cell {
+            std::atomic<usize> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            inline T* value() { return reinterpret_cast<T*>(this->storage); }
+        };
+
+        /**
+         * @brief Claims up to max consecutive slots from an index.
+         *
+         * The slots at index are ready when their sequence is index + lap, they stay
+         * ready until the index is moved past them, so all of them are claimed with a
+         * single compare and swap.
+         *
+         * Complexity: O(max), lock-free
+         *
+         * @param index enqueuePos, or dequeuePos.
+         * @param lap 0 for producers, 1 for consumers.
+         * @param max The maximum amount of slots to claim.
+         * @param pos Output, the position of the first claimed slot.
+         * @return How many slots were claimed, 0 if none was ready.
+         */
+        usize claim(std::atomic<usize>& index, usize lap, usize max, usize& pos) {
+            pos = index.load(std::memory_order_relaxed);
+
+            for (;;) {
+                usize ready = 0;
+                while (ready < max && ready <= this->mask) {
+                    const Cell& cell = this->cells[(pos + ready) & this->mask];
+                    usize sequence = cell.sequence.load(std::memory_order_acquire);
+
+                    if (sequence != pos + ready + lap) {
+                        break;
+                    }
+                    ready++;
+                }
+
+                if (ready == 0) {
+                    // either the ring is full (or empty) or another thread won pos
+                    usize current = index.load(std::memory_order_relaxed);
+                    if (current == pos) {
+                        return 0;
+                    }
+                    pos = current;
+                } else if (index.compare_exchange_weak(pos, pos + ready,
+                                                       std::memory_order_relaxed)) {
+                    return ready;
+                }
+            }
+        }
+
+        /**
+         * @brief Moves the value out of a claimed cell and frees it for the next lap.
+         *
+         * Complexity: O(1)
+         */
+        inline void release(Cell& cell, usize pos, T& out) {
+            T* ptr = cell.value();
+            out = std::move(*ptr);
+            ptr->~T();
+
+            cell.sequence.store(pos + this->mask + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Queues cannot be copied.
+         */
+        MpmcQueue(const MpmcQueue<T>&) = delete;
+        void operator=(const MpmcQueue<T>&) = delete;
+
+      private:
+        /**
+         * @brief The slots of the ring.
+         */
+        Cell* cells;
+        /**
+         * @brief capacity - 1, positions are mapped to slots with it.
+         */
+        usize mask;
+        /**
+         * @brief The next position to be written, only touched by producers.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> enqueuePos;
+        /**
+         * @brief The next position to be read, only touched by consumers, the
+         * alignment also pads whatever follows the queue off its line.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> dequeuePos;
+    };
+
+} // namespace own
+
+#endif // MPMC_QUEUE_GUARD_HEADER
@@ -0,0 +1,266 @@
+#ifndef PARALLEL_GUARD_HEADER
+#define PARALLEL_GUARD_HEADER
+
+#include "list.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+// std::find
+#include <algorithm>
+// std::atomic
+#include <atomic>
+// std::move
+#include <utility>
+
+// ThreadPool from thread_pool.hpp needs C++20
+static_assert(OWN_CPLUSPLUS > 201703L, "parallel.hpp requires C++20 or later");
+
+namespace own {
+
+    /**
+     * @brief Parallel versions of the sequential walks of the containers.
+     *
+     * Every algorithm splits the container into segments with
+     * ThreadPool::forEachIndexedSegment, which takes a single walk for a List and
+     * none for a Vector, then runs the segments on the pool. The calling thread
+     * takes part, so they can be called from inside a task.
+     *
+     * The container must provide len(), begin() and end() and must not be modified
+     * by other threads meanwhile. Callables are invoked concurrently, so they must
+     * be safe to call from many threads at once.
+     *
+     * Usage:
+     *
+     *     own::ThreadPool pool;
+     *     long sum = own::parallel::fold(
+     *         pool, list, [](const int& value, long& acc) { acc += value; }, 0L,
+     *         [](const long& partial, long& acc) { acc += partial; });
+     */
+    namespace parallel {
+
+        /**
+         * @brief Applies the given action to each element in parallel.
+         *
+         * Complexity: O(n / p), where p is the amount of threads
+         *
+         * @param pool The pool running the segments.
+         * @param container The container to be walked.
+         * @param action The callable applied to each element, as List::forEach.
+         * @throws The first exception thrown by the action.
+         */
+        template <typename Container, typename Action>
+        void forEach(ThreadPool& pool, Container& container, Action action) {
+            pool.forEachSegment(container, 0, [&action](auto first, auto last) {
+                for (; first != last; ++first) {
+                    action(*first);
+                }
+            });
+        }
+
+        /**
+         * @brief Folds the elements in parallel.
+         *
+         * Every segment is folded from a copy of identity, then the partial results
+         * are combined in the order of the segments, so combine needs to be
+         * associative but not commutative.
+         *
+         * Complexity: O(n / p + p), where p is the amount of threads
+         *
+         * @param pool The pool running the segments.
+         * @param container The container to be folded.
+         * @param action The callable taking the element and B&, as List::fold.
+         * @param identity The initial value of every segment, it must not change the
+         * result when combined (0 for a sum, 1 for a product).
+         * @param combine The callable taking a partial result as const B& and the
+         * accumulated result as B&.
+         * @return The folded value, identity if the container is empty.
+         * @throws The first exception thrown by action or combine.
+         */
+        template <typename B, typename Container, typename Action, typename Combine>
+        B fold(ThreadPool& pool, Container& container, Action action, B identity,
+               Combine combine) {
+            usize segments = pool.segmentCount(container.len(), 0);
+
+            Vector<B> partials;
+            partials.reserve(segments);
+            for (usize i = 0; i < segments; i++) {
+                partials.pushBack(identity);
+            }
+
+            pool.forEachIndexedSegment(
+                container, segments,
+                [&](auto first, auto last, usize segment, usize) {
+                    // folded apart, neighbouring partials share cache lines
+                    B partial(identity);
+                    for (; first != last; ++first) {
+                        action(*first, partial);
+                    }
+                    partials[segment] = std::move(partial);
+                });
+
+            for (usize i = 0; i < segments; i++) {
+                combine(partials[i], identity);
+            }
+
+            return identity;
+        }
+
+        /**
+         * @brief Finds the first occurrence of a value in parallel.
+         *
+         * Segments past an occurrence already found stop early.
+         *
+         * Complexity: O(n / p), where p is the amount of threads
+         *
+         * @param pool The pool running the segments.
+         * @param container The container to be searched.
+         * @param value The value to be found.
+         * @return The index of the first occurrence of the value, or NO_POS if not
+         * found.
+         */
+        template <typename Container, typename T>
+        usize find(ThreadPool& pool, const Container& container, const T& value) {
+            std::atomic<usize> found(NO_POS);
+
+            pool.forEachIndexedSegment(
+                container, 0, [&value, &found](auto first, auto last, usize, usize at) {
+                    for (; first != last; ++first, ++at) {
+                        usize best = found.load(std::memory_order_relaxed);
+                        if (at >= best) {
+                            return;
+                        }
+
+                        if (*first == value) {
+                            // best is reloaded by every failed exchange
+                            while (at < best && !found.compare_exchange_weak(best, at)) {
+                            }
+                            return;
+                        }
+                    }
+                });
+
+            return found.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Finds all occurrences of a value in parallel.
+         *
+         * Complexity: O(n / p + p), where p is the amount of threads
+         *
+         * @param pool The pool running the segments.
+         * @param container The container to be searched.
+         * @param value The value to be found.
+         * @return A list of indices where the value is found, in ascending order.
+         */
+        template <typename Container, typename T>
+        List<usize> findAll(ThreadPool& pool, const Container& container,
+                            const T& value) {
+            usize segments = pool.segmentCount(container.len(), 0);
+
+            Vector<List<usize> > partials;
+            partials.reserve(segments);
+            for (usize i = 0; i < segments; i++) {
+                partials.pushBack(List<usize>());
+            }
+
+            pool.forEachIndexedSegment(
+                container, segments,
+                [&value, &partials](auto first, auto last, usize segment, usize at) {
+                    List<usize> indices;
+                    for (; first != last; ++first, ++at) {
+                        if (*first == value) {
+                            indices.pushBack(at);
+                        }
+                    }
+                    partials[segment].swap(indices);
+                });
+
+            List<usize> indices;
+            for (usize i = 0; i < segments; i++) {
+                indices.append(partials[i]);
+            }
+
+            return indices;
+        }
+
+        /**
+         * @brief Checks in parallel if every value of other is in the container.
+         *
+         * The values of other are split among the threads, each one searched
+         * through the whole container, and every segment stops as soon as a value
+         * is known to be missing.
+         *
+         * Complexity: O(n * m / p), where m is the length of other and p the amount
+         * of threads
+         *
+         * @param pool The pool running the segments.
+         * @param container The container to be searched.
+         * @param other The values to be checked.
+         * @return True if the container contains all the values, false otherwise.
+         */
+        template <typename Container, typename Other>
+        bool contains(ThreadPool& pool, const Container& container, const Other& other) {
+            std::atomic<bool> missing(false);
+
+            pool.forEachSegment(
+                other, 0, [&container, &missing](auto first, auto last) {
+                    for (; first != last; ++first) {
+                        if (missing.load(std::memory_order_relaxed)) {
+                            return;
+                        }
+
+                        if (std::find(container.begin(), container.end(), *first) ==
+                            container.end()) {
+                            missing.store(true, std::memory_order_relaxed);
+                            return;
+                        }
+                    }
+                });
+
+            return !missing.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retains only the elements that match the given filter, the filter
+         * runs in parallel.
+         *
+         * The filter is evaluated for every element in parallel first, the
+         * elements are then unlinked in a single sequential pass.
+         *
+         * Complexity: O(n / p + n), where p is the amount of threads
+         *
+         * @param pool The pool running the segments.
+         * @param container The container to be filtered, it must provide retainIf
+         * visiting the elements in order, as List, UnrolledList and Vector do.
+         * @param filter A callable that takes a const reference to an element and
+         * returns true if it should be retained, false otherwise.
+         * @return The number of elements that were removed.
+         * @throws The first exception thrown by the filter, nothing is removed then.
+         */
+        template <typename Container, typename Filter>
+        usize retainIf(ThreadPool& pool, Container& container, Filter filter) {
+            usize len = container.len();
+
+            Vector<unsigned char> keep;
+            keep.reserve(len);
+            for (usize i = 0; i < len; i++) {
+                keep.pushBack(0);
+            }
+
+            pool.forEachIndexedSegment(
+                container, 0, [&filter, &keep](auto first, auto last, usize, usize at) {
+                    for (; first != last; ++first, ++at) {
+                        keep[at] = filter(*first) ? 1 : 0;
+                    }
+                });
+
+            usize at = 0;
+            return container.retainIf(
+                [&keep, &at](const auto&) { return keep[at++] != 0; });
+        }
+
+    } // namespace parallel
+
+} // namespace own
+
+#endif // PARALLEL_GUARD_HEADER
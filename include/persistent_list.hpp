@@ -0,0 +1,1006 @@
+#ifndef PERSISTENT_LIST_GUARD_HEADER
+#define PERSISTENT_LIST_GUARD_HEADER
+
+#include "core.hpp"
+#include "vector.hpp"
+
+// std::swap
+#include <algorithm>
+// std::atomic
+#include <atomic>
+// std::ostream operator<< overloading
+#include <ostream>
+// std::istream operator>> overloading
+#include <istream>
+// std::move and std::forward
+#include <utility>
+// std::forward_iterator_tag
+#include <iterator>
+
+namespace own {
+
+    template <typename T>
+    class PersistentList;
+
+    template <typename T>
+    class PersistentQueue;
+
+    namespace details {
+
+        /**
+         * @brief A node of a persistent list, shared by every list whose tail it is.
+         *
+         * It's never modified once linked, only its reference count changes, so
+         * lists sharing it can be read from different threads.
+         */
+        template <typename T>
+        struct PersistentNode {
+            template <typename... Args>
+            PersistentNode(const PersistentNode<T>* next, Args&&... args)
+                : refs(1), next(next), value(std::forward<Args>(args)...) {}
+
+            /**
+             * @brief How many lists and nodes point to this node.
+             */
+            mutable std::atomic<usize> refs;
+            /**
+             * @brief The rest of the list, a reference to it is owned.
+             */
+            const PersistentNode<T>* next;
+            T value;
+        };
+
+        /**
+         * @brief Takes one more reference to a node.
+         *
+         * Complexity: O(1)
+         */
+        template <typename T>
+        inline const PersistentNode<T>* retain(const PersistentNode<T>* node) {
+            if (node) {
+                node->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return node;
+        }
+
+        /**
+         * @brief Drops a reference to a node, freeing it and the rest of the list
+         * nobody else points to.
+         *
+         * Complexity: O(k), where k is the amount of nodes freed
+         */
+        template <typename T>
+        void release(const PersistentNode<T>* node) {
+            // a loop rather than recursion, long lists would overflow the stack
+            while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                const PersistentNode<T>* next = node->next;
+                delete node;
+                node = next;
+            }
+        }
+
+        /**
+         * @brief A forward iterator over a persistent list, elements are read-only
+         * since they can be shared.
+         */
+        template <typename T>
+        class PersistentIterator {
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            PersistentIterator() : node(NULL) {}
+            explicit PersistentIterator(const PersistentNode<T>* node) : node(node) {}
+
+            // Standard forward iterator operations, all of them O(1).
+
+            inline reference operator*() const { return this->node->value; }
+            inline pointer operator->() const { return &this->node->value; }
+
+            inline PersistentIterator& operator++() {
+                this->node = this->node->next;
+                return *this;
+            }
+            inline PersistentIterator operator++(int) {
+                PersistentIterator it = *this;
+                this->node = this->node->next;
+                return it;
+            }
+
+            inline bool operator==(const PersistentIterator& other) const {
+                return this->node == other.node;
+            }
+            inline bool operator!=(const PersistentIterator& other) const {
+                return this->node != other.node;
+            }
+
+          private:
+            const PersistentNode<T>* node;
+        };
+
+        /**
+         * @brief The rear of a persistent queue in the order it's iterated, shared by
+         * the copies of an iterator.
+         */
+        template <typename T>
+        struct PersistentRear {
+            PersistentRear() : refs(1) {}
+
+            std::atomic<usize> refs;
+            Vector<const T*> values;
+        };
+
+        /**
+         * @brief A forward iterator over a persistent queue, it walks the front list
+         * and then the rear from the oldest element on.
+         *
+         * The rear is linked newest first, so begin() collects pointers to its
+         * elements once and the copies of the iterator share them. Elements are
+         * read-only since they can be shared.
+         */
+        template <typename T>
+        class PersistentQueueIterator {
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            /**
+             * @brief Constructs the end iterator.
+             *
+             * Complexity: O(1)
+             */
+            PersistentQueueIterator() : node(NULL), rear(NULL), at(0) {}
+
+            /**
+             * @brief Constructs an iterator to the first element.
+             *
+             * Complexity: O(1), if the rear is empty
+             * Complexity: O(m), otherwise, where m is the length of the rear
+             *
+             * @param node The first node of the front list.
+             * @param rear The first node of the rear list, the newest element.
+             * @param len The length of the rear list.
+             * @throws std::bad_alloc if the rear cannot be collected.
+             */
+            PersistentQueueIterator(const PersistentNode<T>* node,
+                                    const PersistentNode<T>* rear, usize len)
+                : node(node), rear(NULL), at(0) {
+                if (rear == NULL) {
+                    return;
+                }
+
+                this->rear = new PersistentRear<T>();
+                try {
+                    this->rear->values.reserve(len);
+                    for (; rear; rear = rear->next) {
+                        this->rear->values.pushBack(&rear->value);
+                    }
+                } catch (...) {
+                    delete this->rear;
+                    throw;
+                }
+                this->rear->values.reverse();
+            }
+
+            PersistentQueueIterator(const PersistentQueueIterator& other)
+                : node(other.node), rear(other.rear), at(other.at) {
+                if (this->rear) {
+                    this->rear->refs.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            ~PersistentQueueIterator() { this->drop(); }
+
+            PersistentQueueIterator& operator=(const PersistentQueueIterator& other) {
+                if (this->rear != other.rear) {
+                    if (other.rear) {
+                        other.rear->refs.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    this->drop();
+                    this->rear = other.rear;
+                }
+                this->node = other.node;
+                this->at = other.at;
+                return *this;
+            }
+
+            // Standard forward iterator operations, all of them O(1).
+
+            inline reference operator*() const {
+                return this->node ? this->node->value : *this->rear->values[this->at];
+            }
+            inline pointer operator->() const { return &**this; }
+
+            inline PersistentQueueIterator& operator++() {
+                if (this->node) {
+                    this->node = this->node->next;
+                } else {
+                    this->at++;
+                }
+
+                // past the last element every iterator is the same, the end one
+                if (this->node == NULL &&
+                    (this->rear == NULL || this->at == this->rear->values.len())) {
+                    this->drop();
+                    this->rear = NULL;
+                    this->at = 0;
+                }
+                return *this;
+            }
+            inline PersistentQueueIterator operator++(int) {
+                PersistentQueueIterator it = *this;
+                ++*this;
+                return it;
+            }
+
+            friend inline bool operator==(const PersistentQueueIterator& a,
+                                          const PersistentQueueIterator& b) {
+                return a.node == b.node && a.rear == b.rear && a.at == b.at;
+            }
+            friend inline bool operator!=(const PersistentQueueIterator& a,
+                                          const PersistentQueueIterator& b) {
+                return !(a == b);
+            }
+
+          private:
+            /**
+             * @brief Drops the reference to the collected rear.
+             *
+             * Complexity: O(1)
+             */
+            inline void drop() {
+                if (this->rear &&
+                    this->rear->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    delete this->rear;
+                }
+            }
+
+          private:
+            /**
+             * @brief The current node of the front list, NULL once in the rear.
+             */
+            const PersistentNode<T>* node;
+            /**
+             * @brief The rear collected oldest first, NULL if it was empty.
+             */
+            PersistentRear<T>* rear;
+            /**
+             * @brief The index of the current element of the rear.
+             */
+            usize at;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief An immutable singly linked list whose versions share their nodes.
+     *
+     * Copying a list takes a reference to its head, pushFront links a new node
+     * before the shared ones and popFront moves to the next one, so all of them
+     * are O(1) and a snapshot costs one node per element pushed after it. Each
+     * list handle changes only itself, other versions never see it.
+     *
+     * Reference counts are atomic, so snapshots can be handed to other threads by
+     * value, while a single handle must not be changed by two threads at once.
+     *
+     * @tparam T The type of elements stored in the list.
+     */
+    template <typename T>
+    class PersistentList {
+      public:
+        typedef details::PersistentIterator<T> iterator;
+        typedef details::PersistentIterator<T> const_iterator;
+
+        /**
+         * @brief Constructs an empty list.
+         *
+         * Complexity: O(1)
+         */
+        PersistentList() : head(NULL), _len(0) {}
+
+        /**
+         * @brief Constructs a snapshot of another list, sharing all of its nodes.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be shared.
+         */
+        PersistentList(const PersistentList<T>& other)
+            : head(details::retain(other.head)), _len(other._len) {}
+
+        /**
+         * @brief Move constructor, other is left empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be moved.
+         */
+        PersistentList(PersistentList<T>&& other) : head(other.head), _len(other._len) {
+            other.head = NULL;
+            other._len = 0;
+        }
+
+        /**
+         * @brief Destructor, the nodes no other list shares are freed.
+         *
+         * Complexity: O(k), where k is the amount of nodes only this list had
+         */
+        ~PersistentList() { details::release(this->head); }
+
+        /**
+         * @brief Checks if the list is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        inline bool empty() const { return this->head == NULL; }
+
+        /**
+         * @brief Returns the length of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the list.
+         */
+        inline usize len() const { return this->_len; }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A const reference to the value, it may be shared.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& front() const { return this->head->value; }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline const_iterator begin() const { return const_iterator(this->head); }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const { return const_iterator(NULL); }
+
+        /**
+         * @brief Insert a new element at the front of the list, the rest stays shared.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(const T& value) { this->emplaceFront(value); }
+
+        /**
+         * @brief Moves a new element at the front of the list, the rest stays shared.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(T&& value) { this->emplaceFront(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A const reference to the new element.
+         */
+        template <typename... Args>
+        const T& emplaceFront(Args&&... args) {
+            // the new node takes over the reference this list had to head
+            this->head =
+                new details::PersistentNode<T>(this->head, std::forward<Args>(args)...);
+            this->_len++;
+
+            return this->head->value;
+        }
+
+        /**
+         * @brief Removes and returns the first element of the list.
+         *
+         * The value is moved out if no other list shares the node, and copied
+         * otherwise.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popFront() {
+            const details::PersistentNode<T>* node = this->head;
+            this->head = details::retain(node->next);
+            this->_len--;
+
+            if (node->refs.load(std::memory_order_acquire) == 1) {
+                // nobody else can reach the node, so it's ours to change
+                T value = std::move(const_cast<details::PersistentNode<T>*>(node)->value);
+                details::release(node);
+                return value;
+            }
+
+            T value = node->value;
+            details::release(node);
+            return value;
+        }
+
+        /**
+         * @brief Checks if both lists are the same version, without comparing any
+         * element.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to compare with.
+         * @return True if they share their head.
+         */
+        inline bool shares(const PersistentList<T>& other) const {
+            return this->head == other.head;
+        }
+
+        /**
+         * @brief Reverses the order of the elements, new nodes are linked since the
+         * current ones may be shared.
+         *
+         * Complexity: O(n)
+         */
+        void reverse() {
+            PersistentList<T> reversed;
+            for (const_iterator it = this->begin(); it != this->end(); ++it) {
+                reversed.pushFront(*it);
+            }
+
+            this->swap(reversed);
+        }
+
+        /**
+         * @brief Removes all elements from this list, other versions keep theirs.
+         *
+         * Complexity: O(k), where k is the amount of nodes only this list had
+         */
+        void clear() {
+            details::release(this->head);
+            this->head = NULL;
+            this->_len = 0;
+        }
+
+        /**
+         * @brief Swaps the contents of this list with another list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to swap with.
+         */
+        void swap(PersistentList<T>& other) {
+            std::swap(this->head, other.head);
+            std::swap(this->_len, other._len);
+        }
+
+        /**
+         * @brief Checks if both lists hold the same elements in the same order, the
+         * shared part is not compared.
+         *
+         * Complexity: O(n), where n is the amount of nodes that are not shared
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are equal, false otherwise.
+         */
+        bool operator==(const PersistentList<T>& other) const {
+            if (this->_len != other._len) {
+                return false;
+            }
+
+            const details::PersistentNode<T>* it = this->head;
+            const details::PersistentNode<T>* otherIt = other.head;
+            for (; it != otherIt; it = it->next, otherIt = otherIt->next) {
+                if (!(it->value == otherIt->value)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Checks if two lists are not equal.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are not equal, false otherwise.
+         */
+        inline bool operator!=(const PersistentList<T>& other) const {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Makes this list a snapshot of another list.
+         *
+         * Complexity: O(1), plus the nodes only this list had are freed
+         *
+         * @param other The list to be shared.
+         * @return A reference to this list.
+         */
+        PersistentList<T>& operator=(const PersistentList<T>& other) {
+            PersistentList<T> copy(other);
+            this->swap(copy);
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment, other is left empty.
+         *
+         * Complexity: O(1), plus the nodes only this list had are freed
+         *
+         * @param other The list to be moved.
+         * @return A reference to this list.
+         */
+        PersistentList<T>& operator=(PersistentList<T>&& other) {
+            PersistentList<T> taken(std::move(other));
+            this->swap(taken);
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the output stream operator to print the list as a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param list The list to print.
+         * @return The output stream after printing the list.
+         */
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const PersistentList<T>& list) {
+            out << '[';
+
+            for (const_iterator it = list.begin(); it != list.end(); ++it) {
+                if (it != list.begin()) {
+                    out << ", ";
+                }
+                out << *it;
+            }
+
+            out << ']';
+            return out;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the list from a string
+         * representation, the elements are added in front of the current ones.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param list The list to fill.
+         * @return The input stream.
+         */
+        friend std::istream& operator>>(std::istream& in, PersistentList<T>& list) {
+            Vector<T> values;
+            details::readSequence<T>(in, values);
+
+            for (usize i = values.len(); i > 0; i--) {
+                list.pushFront(std::move(values[i - 1]));
+            }
+
+            return in;
+        }
+
+      private:
+        friend class PersistentQueue<T>;
+
+        /**
+         * @brief The first node, a reference to it is owned.
+         */
+        const details::PersistentNode<T>* head;
+        /**
+         * @brief The length of the list.
+         */
+        usize _len;
+    };
+
+    /**
+     * @brief A container for the Stack adapter whose copies are O(1) snapshots.
+     *
+     * The top of the stack is the front of a PersistentList, so
+     * Stack<T, PersistentStack<T> > is copied, taken by intoContainer and
+     * pushed onto in O(1), and its versions share the elements below.
+     *
+     * @tparam T The type of elements stored in the stack.
+     */
+    template <typename T>
+    class PersistentStack {
+      public:
+        typedef typename PersistentList<T>::const_iterator const_iterator;
+
+        inline bool empty() const { return this->list.empty(); }
+        inline usize len() const { return this->list.len(); }
+
+        /**
+         * @brief Returns the top element.
+         *
+         * Complexity: O(1)
+         *
+         * @note it's undefined behavior if stack is empty.
+         */
+        inline const T& back() const { return this->list.front(); }
+
+        /**
+         * @brief Iterators from the top down, which is how Stack walks its container
+         * in reverse.
+         *
+         * Complexity: O(1)
+         */
+        inline const_iterator rbegin() const { return this->list.begin(); }
+        inline const_iterator rend() const { return this->list.end(); }
+
+        /**
+         * @brief Pushes an element onto the top.
+         *
+         * Complexity: O(1)
+         */
+        inline void pushBack(const T& value) { this->list.pushFront(value); }
+        inline void pushBack(T&& value) { this->list.pushFront(std::move(value)); }
+
+        /**
+         * @brief Constructs an element onto the top.
+         *
+         * Complexity: O(1)
+         *
+         * @return A const reference to the new element.
+         */
+        template <typename... Args>
+        inline const T& emplaceBack(Args&&... args) {
+            return this->list.emplaceFront(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes and returns the top element.
+         *
+         * Complexity: O(1)
+         *
+         * @note it's undefined behavior if stack is empty.
+         */
+        inline T popBack() { return this->list.popFront(); }
+
+        /**
+         * @brief Pushes the elements of other onto this stack, bottom first, so the
+         * top of other ends up on top. Other is left empty.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The stack to be appended.
+         */
+        void append(PersistentStack<T>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            other.list.reverse();
+            while (!other.list.empty()) {
+                this->list.pushFront(other.list.popFront());
+            }
+        }
+
+        /**
+         * @brief Reverses the stack, the bottom becomes the top.
+         *
+         * Complexity: O(n)
+         */
+        inline void reverse() { this->list.reverse(); }
+        inline void clear() { this->list.clear(); }
+        inline void swap(PersistentStack<T>& other) { this->list.swap(other.list); }
+
+        inline bool operator==(const PersistentStack<T>& other) const {
+            return this->list == other.list;
+        }
+        inline bool operator!=(const PersistentStack<T>& other) const {
+            return this->list != other.list;
+        }
+
+        /**
+         * @brief Prints the stack from the top down.
+         *
+         * Complexity: O(n)
+         */
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const PersistentStack<T>& stack) {
+            return out << stack.list;
+        }
+
+      private:
+        PersistentList<T> list;
+    };
+
+    /**
+     * @brief A container for the Queue adapter whose copies are O(1) snapshots.
+     *
+     * Elements are popped from a front list and pushed onto a rear list, newest
+     * first. Once the front runs out the rear is reversed into it, so every
+     * element is copied once and operations are amortized O(1).
+     *
+     * @note The rear is reversed by the version that pops, snapshots taken before
+     * reverse it again if they pop as well.
+     *
+     * @tparam T The type of elements stored in the queue.
+     */
+    template <typename T>
+    class PersistentQueue {
+      public:
+        typedef details::PersistentQueueIterator<T> iterator;
+        typedef details::PersistentQueueIterator<T> const_iterator;
+
+        /**
+         * @brief Constructs an empty queue.
+         *
+         * Complexity: O(1)
+         */
+        PersistentQueue() : last(NULL) {}
+
+        inline bool empty() const { return this->head.empty(); }
+        inline usize len() const { return this->head.len() + this->rear.len(); }
+
+        /**
+         * @brief Returns the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @note it's undefined behavior if queue is empty.
+         */
+        inline const T& front() const { return this->head.front(); }
+
+        /**
+         * @brief Returns the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @note it's undefined behavior if queue is empty.
+         */
+        inline const T& back() const {
+            return this->rear.empty() ? this->last->value : this->rear.front();
+        }
+
+        /**
+         * @brief Returns an iterator to the front element, the walk goes to the
+         * back.
+         *
+         * Complexity: O(1), if nothing was pushed since the last rotation
+         * Complexity: O(m), otherwise, where m is the amount of elements pushed
+         *
+         * @return The iterator, equal to end() if the queue is empty.
+         * @throws std::bad_alloc if the pushed elements cannot be collected.
+         */
+        inline const_iterator begin() const {
+            return const_iterator(this->head.head, this->rear.head, this->rear.len());
+        }
+
+        /**
+         * @brief Returns an iterator past the back element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const { return const_iterator(); }
+
+        inline const_iterator cbegin() const { return this->begin(); }
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Adds an element to the end of the queue.
+         *
+         * Complexity: O(1)
+         */
+        inline void pushBack(const T& value) { this->emplaceBack(value); }
+        inline void pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Constructs an element at the end of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return A const reference to the new element.
+         */
+        template <typename... Args>
+        const T& emplaceBack(Args&&... args) {
+            // the front is only empty if the whole queue is
+            if (this->head.empty()) {
+                this->head.emplaceFront(std::forward<Args>(args)...);
+                this->last = this->head.head;
+                return this->last->value;
+            }
+
+            return this->rear.emplaceFront(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes and returns the first element.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @note it's undefined behavior if queue is empty.
+         */
+        T popFront() {
+            T value = this->head.popFront();
+
+            if (this->head.empty()) {
+                this->last = NULL;
+                this->rotate();
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this queue, other is left
+         * empty.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The queue to be appended.
+         */
+        void append(PersistentQueue<T>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            while (!other.empty()) {
+                this->pushBack(other.popFront());
+            }
+        }
+
+        /**
+         * @brief Calls the action with every element, from the front to the back.
+         *
+         * Complexity: O(n)
+         *
+         * @param action The callable taking a const T&.
+         */
+        template <typename Action>
+        void forEach(Action action) const {
+            for (const T& value : *this) {
+                action(value);
+            }
+        }
+
+        /**
+         * @brief Reverses the order of the elements, the back becomes the front.
+         *
+         * Complexity: O(n)
+         */
+        void reverse() {
+            PersistentList<T> reversed;
+            const details::PersistentNode<T>* first = NULL;
+
+            this->forEach([&reversed, &first](const T& value) {
+                reversed.pushFront(value);
+                if (first == NULL) {
+                    first = reversed.head;
+                }
+            });
+
+            this->head.swap(reversed);
+            this->rear.clear();
+            this->last = first;
+        }
+
+        void clear() {
+            this->head.clear();
+            this->rear.clear();
+            this->last = NULL;
+        }
+
+        void swap(PersistentQueue<T>& other) {
+            this->head.swap(other.head);
+            this->rear.swap(other.rear);
+            std::swap(this->last, other.last);
+        }
+
+        /**
+         * @brief Checks if both queues hold the same elements in the same order.
+         *
+         * Complexity: O(1), if they are the same version
+         * Complexity: O(n), otherwise
+         */
+        bool operator==(const PersistentQueue<T>& other) const {
+            if (this->len() != other.len()) {
+                return false;
+            }
+            if (this->head.shares(other.head) && this->rear.shares(other.rear)) {
+                return true;
+            }
+
+            Vector<const T*> values;
+            values.reserve(this->len());
+            this->forEach([&values](const T& value) { values.pushBack(&value); });
+
+            usize i = 0;
+            bool equal = true;
+            other.forEach([&values, &i, &equal](const T& value) {
+                equal = equal && *values[i++] == value;
+            });
+
+            return equal;
+        }
+
+        inline bool operator!=(const PersistentQueue<T>& other) const {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Prints the queue from the front to the back.
+         *
+         * Complexity: O(n)
+         */
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const PersistentQueue<T>& queue) {
+            bool first = true;
+
+            out << '[';
+            queue.forEach([&out, &first](const T& value) {
+                if (!first) {
+                    out << ", ";
+                }
+                out << value;
+                first = false;
+            });
+            out << ']';
+
+            return out;
+        }
+
+      private:
+        /**
+         * @brief Reverses the rear into the empty front.
+         *
+         * Complexity: O(m), where m is the length of the rear
+         */
+        void rotate() {
+            while (!this->rear.empty()) {
+                this->head.pushFront(this->rear.popFront());
+                if (this->last == NULL) {
+                    this->last = this->head.head;
+                }
+            }
+        }
+
+      private:
+        /**
+         * @brief The oldest elements, the front first.
+         */
+        PersistentList<T> head;
+        /**
+         * @brief The newest elements, the back first.
+         */
+        PersistentList<T> rear;
+        /**
+         * @brief The last node of head, the back if rear is empty.
+         */
+        const details::PersistentNode<T>* last;
+    };
+
+} // namespace own
+
+#endif // PERSISTENT_LIST_GUARD_HEADER
@@ -0,0 +1,331 @@
+#ifndef POOL_GUARD_HEADER
+#define POOL_GUARD_HEADER
+
+#include "list.hpp"
+
+namespace own {
+
+    /**
+     * @brief Default amount of objects carved out of every chunk of a pool.
+     */
+    const usize POOL_CHUNK_LEN = 64;
+
+    namespace details {
+
+        /**
+         * @brief A reference counted arena of fixed-size slots.
+         *
+         * Slots are carved out of large chunks, released slots are kept in a free
+         * list and handed out again before carving new ones, so once the pool has
+         * grown enough there are no more calls to the global allocator.
+         *
+         * Chunks are only released when the last reference to the pool is gone.
+         *
+         * @tparam T The type of the objects stored in the slots.
+         */
+        template <typename T>
+        class Pool {
+          public:
+            /**
+             * @brief Constructs an empty pool with a single reference.
+             *
+             * Complexity: O(1)
+             *
+             * @param chunkLen How many slots are carved out of every chunk.
+             */
+            Pool(usize chunkLen) {
+                this->chunkLen = chunkLen > 0 ? chunkLen : 1;
+                this->refs = 1;
+                this->chunks = NULL;
+                this->free = NULL;
+                this->cursor = NULL;
+                this->end = NULL;
+            }
+
+            /**
+             * @brief Releases every chunk of the pool.
+             *
+             * Complexity: O(c), where c is the amount of chunks
+             */
+            ~Pool() {
+                Slot* it = this->chunks;
+                while (it) {
+                    Slot* next = it->next;
+                    ::operator delete(it);
+                    it = next;
+                }
+            }
+
+            /**
+             * @brief Adds a reference to the pool.
+             *
+             * Complexity: O(1)
+             */
+            inline void retain() { this->refs++; }
+
+            /**
+             * @brief Removes a reference to the pool, deleting it if it was the last
+             * one.
+             *
+             * Complexity: O(1), if there are references left
+             * Complexity: O(c), otherwise
+             */
+            inline void release() {
+                if (--this->refs == 0) {
+                    delete this;
+                }
+            }
+
+            /**
+             * @brief Returns uninitialized storage for one object.
+             *
+             * Complexity: O(1), amortized
+             *
+             * @return A pointer to the storage.
+             * @throws std::bad_alloc if a new chunk is needed and cannot be allocated.
+             */
+            T* allocate() {
+                if (this->free) {
+                    Slot* slot = this->free;
+                    this->free = slot->next;
+                    return reinterpret_cast<T*>(slot);
+                }
+                if (this->cursor == this->end) {
+                    this->grow(this->chunkLen);
+                }
+
+                return reinterpret_cast<T*>(this->cursor++);
+            }
+
+            /**
+             * @brief Gives the storage back to the pool.
+             *
+             * Complexity: O(1)
+             *
+             * @param ptr The storage returned by allocate.
+             */
+            inline void deallocate(T* ptr) {
+                Slot* slot = reinterpret_cast<Slot*>(ptr);
+                slot->next = this->free;
+                this->free = slot;
+            }
+
+            /**
+             * @brief Ensures that the next count allocations don't need a new chunk,
+             * by carving a single chunk large enough for them.
+             *
+             * The unused rest of the newest chunk goes to the free list first, so
+             * nothing is wasted.
+             *
+             * Complexity: O(B), where B is the length of a chunk
+             *
+             * @param count The amount of upcoming allocations.
+             * @throws std::bad_alloc if the chunk cannot be allocated.
+             */
+            void reserve(usize count) {
+                usize left = usize(this->end - this->cursor);
+                if (left >= count) {
+                    return;
+                }
+
+                while (this->cursor != this->end) {
+                    this->deallocate(reinterpret_cast<T*>(this->cursor++));
+                }
+
+                count -= left;
+                this->grow(count > this->chunkLen ? count : this->chunkLen);
+            }
+
+          private:
+            /**
+             * @brief Storage of one object, or the link to the next free slot.
+             */
+            union Slot {
+                Slot* next;
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
+
+            /**
+             * @brief Allocates a new chunk, its first slot links the previous chunk.
+             *
+             * Complexity: O(1)
+             *
+             * @param len How many slots are carved out of the chunk.
+             */
+            void grow(usize len) {
+                usize size = sizeof(Slot) * (len + 1);
+                Slot* chunk = static_cast<Slot*>(::operator new(size));
+
+                chunk->next = this->chunks;
+                this->chunks = chunk;
+
+                this->cursor = chunk + 1;
+                this->end = chunk + 1 + len;
+            }
+
+            /**
+             * @brief Pools cannot be copied, only shared.
+             */
+            Pool(const Pool<T>&) = delete;
+            void operator=(const Pool<T>&) = delete;
+
+          private:
+            /**
+             * @brief How many slots are carved out of every chunk.
+             */
+            usize chunkLen;
+            /**
+             * @brief How many allocators are sharing the pool.
+             */
+            usize refs;
+            /**
+             * @brief The allocated chunks.
+             */
+            Slot* chunks;
+            /**
+             * @brief The released slots.
+             */
+            Slot* free;
+            /**
+             * @brief Next never used slot of the newest chunk.
+             */
+            Slot* cursor;
+            /**
+             * @brief End of the newest chunk.
+             */
+            Slot* end;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A node allocator that recycles objects through a shared pool.
+     *
+     * Copies of a PoolAllocator share the same pool, so lists built from the same
+     * allocator can exchange nodes (append, sliceOff, swap) in O(1) while the pool
+     * remains alive as long as any of them is.
+     *
+     * Usage:
+     *
+     *     own::List<int, own::PoolAllocator>::NodeAllocator pool;
+     *     own::List<int, own::PoolAllocator> a(pool), b(pool);
+     *
+     * @note The pool is not thread-safe, lists sharing it must live in the same
+     * thread.
+     *
+     * @tparam T The type of the objects being allocated.
+     */
+    template <typename T>
+    class PoolAllocator {
+      public:
+        /**
+         * @brief Constructs an allocator with a new pool.
+         *
+         * Complexity: O(1)
+         *
+         * @param chunkLen How many objects are carved out of every chunk.
+         */
+        PoolAllocator(usize chunkLen = POOL_CHUNK_LEN) {
+            this->pool = new details::Pool<T>(chunkLen);
+        }
+
+        /**
+         * @brief Copy constructor, the pool is shared.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The allocator to be copied.
+         */
+        PoolAllocator(const PoolAllocator<T>& other) {
+            this->pool = other.pool;
+            this->pool->retain();
+        }
+
+        /**
+         * @brief Destructor, drops the reference to the pool.
+         *
+         * Complexity: O(1), if the pool is still shared
+         * Complexity: O(c), otherwise, where c is the amount of chunks
+         */
+        ~PoolAllocator() { this->pool->release(); }
+
+        /**
+         * @brief Allocates uninitialized storage for one object.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @return A pointer to the allocated storage.
+         * @throws std::bad_alloc if the pool cannot grow.
+         */
+        inline T* allocate() { return this->pool->allocate(); }
+
+        /**
+         * @brief Gives the storage back to the pool.
+         *
+         * Complexity: O(1)
+         *
+         * @param ptr The storage to be released.
+         */
+        inline void deallocate(T* ptr) { this->pool->deallocate(ptr); }
+
+        /**
+         * @brief Ensures that the next count allocations don't need the global
+         * allocator, List::generateBack calls it before building its nodes.
+         *
+         * Complexity: O(B), where B is the length of a chunk
+         *
+         * @param count The amount of upcoming allocations.
+         * @throws std::bad_alloc if the pool cannot grow.
+         */
+        inline void reserve(usize count) { this->pool->reserve(count); }
+
+        /**
+         * @brief Checks if both allocators share the same pool.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The allocator to be compared.
+         * @return True if they share the pool, false otherwise.
+         */
+        inline bool operator==(const PoolAllocator<T>& other) const {
+            return this->pool == other.pool;
+        }
+
+        /**
+         * @brief Checks if both allocators use different pools.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The allocator to be compared.
+         * @return True if they use different pools, false otherwise.
+         */
+        inline bool operator!=(const PoolAllocator<T>& other) const {
+            return this->pool != other.pool;
+        }
+
+        /**
+         * @brief Assignment operator, the pool of other is shared.
+         *
+         * Complexity: O(1), if the previous pool is still shared
+         * Complexity: O(c), otherwise
+         *
+         * @param other The allocator to be assigned.
+         * @return A reference to this allocator.
+         */
+        PoolAllocator<T>& operator=(const PoolAllocator<T>& other) {
+            other.pool->retain();
+            this->pool->release();
+            this->pool = other.pool;
+            return *this;
+        }
+
+      private:
+        /**
+         * @brief The shared pool.
+         */
+        details::Pool<T>* pool;
+    };
+
+} // namespace own
+
+#endif // POOL_GUARD_HEADER
@@ -0,0 +1,394 @@
+#ifndef PRIORITY_QUEUE_GUARD_HEADER
+#define PRIORITY_QUEUE_GUARD_HEADER
+
+#include "core.hpp"
+#include "vector.hpp"
+
+// std::swap
+#include <algorithm>
+// std::less
+#include <functional>
+// std::ostream operator<< overloading
+#include <ostream>
+// std::move and std::forward
+#include <utility>
+
+namespace own {
+
+    /**
+     * @brief A queue popping its greatest element first, kept as a d-ary heap in a
+     * contiguous container.
+     *
+     * A wider heap is shallower, so pushes compare less and pops touch fewer cache
+     * lines per level at the cost of comparing more children. 4 is usually the
+     * best for small T, 2 is the classic binary heap.
+     *
+     * Elements are moved into a hole on their way up or down instead of being
+     * swapped, one move per level.
+     *
+     * Usage:
+     *
+     *     // earliest deadline first
+     *     own::PriorityQueue<Job, own::Vector<Job>, LaterDeadline, 4> jobs;
+     *
+     * @tparam T The type of the value stored in the queue.
+     * @tparam Container The underlying container, Vector<T> by default, it must
+     * provide operator[], len, emplaceBack and popBack.
+     * @tparam Compare A callable returning true if its first argument has a lower
+     * priority than the second one, std::less<T> pops the greatest element.
+     * @tparam Arity The amount of children of every node of the heap, at least 2.
+     */
+    template <typename T, typename Container = Vector<T>,
+              typename Compare = std::less<T>, usize Arity = 2>
+    class PriorityQueue {
+        static_assert(Arity >= 2, "a heap node needs at least two children");
+
+      public:
+        /**
+         * @brief Constructs an empty priority queue.
+         *
+         * Complexity: O(1)
+         *
+         * @param less The comparison of priorities.
+         */
+        explicit PriorityQueue(const Compare& less = Compare()) : less(less) {}
+
+        /**
+         * @brief Constructs a priority queue taking over the elements of a container,
+         * they are arranged into a heap at once.
+         *
+         * Complexity: O(n)
+         *
+         * @param container The initial elements, in any order.
+         * @param less The comparison of priorities.
+         */
+        explicit PriorityQueue(Container&& container, const Compare& less = Compare())
+            : container(std::move(container)), less(less) {
+            this->heapify();
+        }
+
+        /**
+         * @brief Constructs a priority queue with a copy of the elements of a
+         * container.
+         *
+         * Complexity: O(n)
+         *
+         * @param container The initial elements, in any order.
+         * @param less The comparison of priorities.
+         */
+        explicit PriorityQueue(const Container& container,
+                               const Compare& less = Compare())
+            : container(container), less(less) {
+            this->heapify();
+        }
+
+        /**
+         * @brief Checks if the priority queue is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return true if the queue is empty, false otherwise.
+         */
+        inline bool empty() const { return this->container.empty(); }
+
+        /**
+         * @brief Returns the number of elements in the priority queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the queue.
+         */
+        inline usize len() const { return this->container.len(); }
+
+        /**
+         * @brief Returns the element with the highest priority.
+         *
+         * Complexity: O(1)
+         *
+         * @return A const reference to the element, it can't be changed in place as
+         * that would break the heap.
+         *
+         * @note It's undefined behavior, if queue is empty.
+         */
+        inline const T& top() const { return this->container[0]; }
+
+        /**
+         * @brief Reserves storage for the given amount of elements, the container
+         * must provide reserve.
+         *
+         * Complexity: O(n), if the storage has to grow
+         * Complexity: O(1), otherwise
+         *
+         * @param capacity The minimum capacity.
+         */
+        void reserve(usize capacity) { this->container.reserve(capacity); }
+
+        /**
+         * @brief Adds an element to the priority queue.
+         *
+         * Complexity: O(log n)
+         *
+         * @param value The value to be added.
+         */
+        inline void push(const T& value) { this->emplace(value); }
+
+        /**
+         * @brief Moves an element into the priority queue.
+         *
+         * Complexity: O(log n)
+         *
+         * @param value The value to be moved.
+         */
+        inline void push(T&& value) { this->emplace(std::move(value)); }
+
+        /**
+         * @brief Constructs an element in the priority queue.
+         *
+         * Complexity: O(log n)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args) {
+            this->container.emplaceBack(std::forward<Args>(args)...);
+
+            usize last = this->container.len() - 1;
+            this->siftUp(last, std::move(this->container[last]));
+        }
+
+        /**
+         * @brief Adds a copy of the elements from first to last.
+         *
+         * They are sifted up one by one if the heap is larger than the range, else
+         * the whole heap is rebuilt at once.
+         *
+         * Complexity: O(min(m log(n + m), n + m)), where m is the length of the range
+         *
+         * @param first The first element to be added.
+         * @param last Past the last element to be added.
+         */
+        template <typename Iterator>
+        void pushBatch(Iterator first, Iterator last) {
+            usize oldLen = this->container.len();
+            for (; first != last; ++first) {
+                this->container.emplaceBack(*first);
+            }
+
+            usize added = this->container.len() - oldLen;
+            if (added > oldLen) {
+                this->heapify();
+                return;
+            }
+
+            for (usize i = oldLen; i < this->container.len(); i++) {
+                this->siftUp(i, std::move(this->container[i]));
+            }
+        }
+
+        /**
+         * @brief Removes and returns the element with the highest priority, the value
+         * is moved out.
+         *
+         * Complexity: O(log n)
+         *
+         * @return The value of the element.
+         *
+         * @note It's undefined behavior, if queue is empty.
+         */
+        T pop() {
+            T value = std::move(this->container[0]);
+
+            usize last = this->container.len() - 1;
+            if (last == 0) {
+                this->container.popBack();
+                return value;
+            }
+
+            T moved = std::move(this->container[last]);
+            this->container.popBack();
+
+            // the last element usually belongs near the bottom, so the hole goes
+            // all the way down without comparing it and then it sifts up a little
+            usize hole = 0;
+            for (;;) {
+                usize best = this->bestChild(hole, last);
+                if (best == 0) {
+                    break;
+                }
+
+                this->container[hole] = std::move(this->container[best]);
+                hole = best;
+            }
+
+            this->siftUp(hole, std::move(moved));
+            return value;
+        }
+
+        /**
+         * @brief Removes up to n elements, moving them to out from the highest
+         * priority down.
+         *
+         * Complexity: O(m log n), where m is n or the length if it's shorter
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value.
+         */
+        template <typename Output>
+        Output popBatch(Output out, usize n) {
+            for (; n > 0 && !this->container.empty(); n--) {
+                *out = this->pop();
+                ++out;
+            }
+
+            return out;
+        }
+
+        /**
+         * @brief Removes all elements from the priority queue.
+         *
+         * Complexity: O(n)
+         */
+        void clear() { this->container.clear(); }
+
+        /**
+         * @brief Swaps the contents of two priority queues.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The queue to be swapped with.
+         */
+        void swap(PriorityQueue<T, Container, Compare, Arity>& other) {
+            this->container.swap(other.container);
+            std::swap(this->less, other.less);
+        }
+
+        /**
+         * @brief Converts the priority queue into a container, in heap order.
+         *
+         * Complexity: O(n)
+         *
+         * @return A container containing the elements of the queue.
+         */
+        Container intoContainer() const& { return this->container; }
+
+        /**
+         * @brief Converts an expiring priority queue into a container, in heap
+         * order, the elements are moved.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @return A container containing the elements of the queue.
+         */
+        Container intoContainer() && { return std::move(this->container); }
+
+        /**
+         * @brief Overloads the << operator for PriorityQueue, the elements are
+         * printed in heap order.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param queue The queue to be outputted.
+         * @return The updated output stream.
+         */
+        friend std::ostream& operator<<(
+            std::ostream& out, const PriorityQueue<T, Container, Compare, Arity>& queue) {
+            return details::writeSequence(out, queue.container);
+        }
+
+      private:
+        /**
+         * @brief Returns the child of i with the highest priority, 0 if i is a leaf.
+         *
+         * Complexity: O(Arity)
+         */
+        inline usize bestChild(usize i, usize len) const {
+            usize first = i * Arity + 1;
+            if (first >= len) {
+                return 0;
+            }
+
+            usize end = first + Arity < len ? first + Arity : len;
+            usize best = first;
+            for (usize child = first + 1; child < end; child++) {
+                if (this->less(this->container[best], this->container[child])) {
+                    best = child;
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Places value in the hole at i, moving it up until its parent has a
+         * higher priority.
+         *
+         * Complexity: O(log n)
+         */
+        void siftUp(usize i, T value) {
+            while (i > 0) {
+                usize parent = (i - 1) / Arity;
+                if (!this->less(this->container[parent], value)) {
+                    break;
+                }
+
+                this->container[i] = std::move(this->container[parent]);
+                i = parent;
+            }
+
+            this->container[i] = std::move(value);
+        }
+
+        /**
+         * @brief Moves the element at i down until no child has a higher priority.
+         *
+         * Complexity: O(Arity log n)
+         */
+        void siftDown(usize i) {
+            usize len = this->container.len();
+            T value = std::move(this->container[i]);
+
+            for (;;) {
+                usize best = this->bestChild(i, len);
+                if (best == 0 || !this->less(value, this->container[best])) {
+                    break;
+                }
+
+                this->container[i] = std::move(this->container[best]);
+                i = best;
+            }
+
+            this->container[i] = std::move(value);
+        }
+
+        /**
+         * @brief Arranges every element into a heap, from the last parent up.
+         *
+         * Complexity: O(n)
+         */
+        void heapify() {
+            usize len = this->container.len();
+            if (len < 2) {
+                return;
+            }
+
+            for (usize i = (len - 2) / Arity + 1; i > 0; i--) {
+                this->siftDown(i - 1);
+            }
+        }
+
+      private:
+        /**
+         * @brief the underlying container, in heap order
+         */
+        Container container;
+        /**
+         * @brief the comparison of priorities
+         */
+        Compare less;
+    };
+
+} // namespace own
+
+#endif // PRIORITY_QUEUE_GUARD_HEADER
@@ -3,12 +3,27 @@
 
 #include "list.hpp"
 
+// std::move and std::forward
+#include <utility>
+
 namespace own {
 
     /**
      * @brief A class representing a queue.
      *
      * @tparam T The type of the value stored in the queue.
+     * @tparam Container The underlying container, List<T> by default, RingBuffer<T>
+     * or FixedRingBuffer<T, N> store the elements contiguously, SmallRingBuffer<T, K>
+     * keeps the first K of them inline, ReversibleList<T> makes reverse() O(1),
+     * MappedList<T> keeps the queue in a file across restarts, PersistentQueue<T>
+     * makes copies O(1) snapshots and StaticList<T, N> never allocates, which makes
+     * the queue usable in constant expressions, see StaticQueue.
+     *
+     * Iterating a queue walks from the front to the back.
+     *
+     * Elements are accessed through whatever the container returns, so
+     * Queue<T*, IntrusiveList<T> > links objects in place and front() returns a
+     * pointer.
      */
     template <typename T, typename Container = List<T> >
     class Queue {
@@ -20,14 +35,23 @@ namespace own {
          *
          * @param data The initial data to be stored in the queue.
          */
-        Queue(const Container& container) { this->container = container; }
+        constexpr Queue(const Container& container) : container(container) {}
+
+        /**
+         * @brief Constructs a Queue object taking over the given data.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @param data The initial data to be moved into the queue.
+         */
+        constexpr Queue(Container&& container) : container(std::move(container)) {}
 
         /**
          * @brief Default constructor for Queue.
          *
          * Complexity: O(1)
          */
-        Queue() {}
+        constexpr Queue() {}
 
         /**
          * @brief Copy constructor for Queue.
@@ -36,7 +60,17 @@ namespace own {
          *
          * @param other The queue to be copied.
          */
-        Queue(const Queue<T>& other) { this->container = other.container; }
+        constexpr Queue(const Queue<T, Container>& other) : container(other.container) {}
+
+        /**
+         * @brief Move constructor for Queue, other is left empty.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @param other The queue to be moved.
+         */
+        constexpr Queue(Queue<T, Container>&& other)
+            : container(std::move(other.container)) {}
 
         /**
          * @brief Checks if the queue is empty.
@@ -45,7 +79,7 @@ namespace own {
          *
          * @return true if the queue is empty, false otherwise.
          */
-        inline bool empty() const { return this->container.empty(); }
+        constexpr bool empty() const { return this->container.empty(); }
 
         /**
          * @brief Returns the number of elements in the queue.
@@ -54,7 +88,7 @@ namespace own {
          *
          * @return The length of the queue.
          */
-        inline usize len() const { return this->container.len(); }
+        constexpr usize len() const { return this->container.len(); }
 
         /**
          * @brief Returns a reference to the first element in the queue.
@@ -65,7 +99,7 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        const T& front() const { return this->container.front(); }
+        constexpr decltype(auto) front() const { return this->container.front(); }
 
         /**
          * @brief Returns a reference to the first element in the queue.
@@ -76,7 +110,7 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        T& front() { return this->container.front(); }
+        constexpr decltype(auto) front() { return this->container.front(); }
 
         /**
          * @brief Returns a reference to the last element in the queue.
@@ -87,7 +121,7 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        const T& back() const { return this->container.back(); }
+        constexpr decltype(auto) back() const { return this->container.back(); }
 
         /**
          * @brief Returns a reference to the last element in the queue.
@@ -98,7 +132,43 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        T& back() { return this->container.back(); }
+        constexpr decltype(auto) back() { return this->container.back(); }
+
+        /**
+         * @brief Returns an iterator to the front element of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container, equal to end() if the queue is empty.
+         */
+        constexpr auto begin() { return this->container.begin(); }
+
+        /**
+         * @brief Returns an iterator to the front element of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container, equal to end() if the queue is empty.
+         */
+        constexpr auto begin() const { return this->container.begin(); }
+
+        /**
+         * @brief Returns an iterator past the back element of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container.
+         */
+        constexpr auto end() { return this->container.end(); }
+
+        /**
+         * @brief Returns an iterator past the back element of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container.
+         */
+        constexpr auto end() const { return this->container.end(); }
 
         /**
          * @brief Adds an element to the end of the queue.
@@ -107,10 +177,33 @@ namespace own {
          *
          * @param value The value to be added to the queue.
          */
-        void push(T value) { this->container.pushBack(value); }
+        constexpr void push(const T& value) { this->container.pushBack(value); }
+
+        /**
+         * @brief Moves an element to the end of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be moved into the queue.
+         */
+        constexpr void push(T&& value) { this->container.pushBack(std::move(value)); }
 
         /**
-         * @brief Removes and returns the first element in the queue.
+         * @brief Constructs an element in place at the end of the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        constexpr decltype(auto) emplace(Args&&... args) {
+            return this->container.emplaceBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes and returns the first element in the queue, the value is
+         * moved out.
          *
          * Complexity: O(1)
          *
@@ -118,7 +211,52 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        T pop() { return this->container.popFront(); }
+        constexpr T pop() { return this->container.popFront(); }
+
+        /**
+         * @brief Adds a copy of the elements from first to last to the end of the
+         * queue, in order.
+         *
+         * Complexity: O(m), where m is the length of the range, a List links the
+         * nodes in a single pass and updates its length once
+         *
+         * @param first The first element to be added.
+         * @param last Past the last element to be added.
+         */
+        template <typename Iterator>
+        constexpr void pushBatch(Iterator first, Iterator last) {
+            if constexpr (details::HasPushBackN<Container, Iterator>::value) {
+                this->container.pushBackN(first, last);
+            } else {
+                for (; first != last; ++first) {
+                    this->container.pushBack(*first);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes up to n elements from the front of the queue, moving them
+         * to out in order.
+         *
+         * Complexity: O(m), where m is n or the length if it's shorter
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value.
+         */
+        template <typename Output>
+        constexpr Output popBatch(Output out, usize n) {
+            if constexpr (details::HasPopFrontN<Container, Output>::value) {
+                return this->container.popFrontN(out, n);
+            } else {
+                for (; n > 0 && !this->container.empty(); n--) {
+                    *out = this->container.popFront();
+                    ++out;
+                }
+
+                return out;
+            }
+        }
 
         /**
          * @brief Appends the elements of another queue to the current queue.
@@ -127,21 +265,33 @@ namespace own {
          *
          * @param other The queue to be appended.
          */
-        void append(Queue<T>& other) { this->container.append(other.container); }
+        constexpr void append(Queue<T, Container>& other) {
+            this->container.append(other.container);
+        }
+
+        /**
+         * @brief Appends the elements of an expiring queue to the current queue.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The queue to be appended.
+         */
+        constexpr void append(Queue<T, Container>&& other) { this->append(other); }
 
         /**
          * @brief Reverses the order of elements in the queue.
          *
          * Complexity: O(n)
+         * Complexity: O(1), if the container is a ReversibleList
          */
-        void reverse() { this->container.reverse(); }
+        constexpr void reverse() { this->container.reverse(); }
 
         /**
          * @brief Removes all elements from the queue.
          *
          * Complexity: O(n)
          */
-        void clear() { this->container.clear(); }
+        constexpr void clear() { this->container.clear(); }
 
         /**
          * @brief Swaps the contents of two queues.
@@ -150,7 +300,9 @@ namespace own {
          *
          * @param other The queue to be swapped with.
          */
-        void swap(Queue<T>& other) { this->container.swap(other.container); }
+        constexpr void swap(Queue<T, Container>& other) {
+            this->container.swap(other.container);
+        }
 
         /**
          * @brief Converts the queue into a container.
@@ -159,7 +311,17 @@ namespace own {
          *
          * @return A container containing the elements of the queue.
          */
-        Container intoContainer() const { return this->container; }
+        constexpr Container intoContainer() const& { return this->container; }
+
+        /**
+         * @brief Converts an expiring queue into a container, the elements are
+         * moved.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @return A container containing the elements of the queue.
+         */
+        constexpr Container intoContainer() && { return std::move(this->container); }
 
         /**
          * @brief Concatenates two queues and returns a new queue.
@@ -169,8 +331,22 @@ namespace own {
          * @param other The queue to be concatenated.
          * @return A new queue containing the elements of both queues.
          */
-        Queue<T> operator+(const Queue<T>& other) const {
-            return Queue<T>(this->container + other.container);
+        constexpr Queue<T, Container> operator+(const Queue<T, Container>& other) const& {
+            return Queue<T, Container>(this->container + other.container);
+        }
+
+        /**
+         * @brief Concatenates two expiring queues, reusing their elements.
+         *
+         * Complexity: O(1), if the container concatenates expiring containers in
+         * O(1), as a List does
+         *
+         * @param other The queue to be concatenated.
+         * @return A new queue containing the elements of both queues.
+         */
+        constexpr Queue<T, Container> operator+(Queue<T, Container>&& other) && {
+            return Queue<T, Container>(std::move(this->container) +
+                                       std::move(other.container));
         }
 
         /**
@@ -181,11 +357,25 @@ namespace own {
          * @param other The queue to be appended.
          * @return A reference to the updated queue.
          */
-        Queue<T>& operator+=(const Queue<T>& other) {
+        constexpr Queue<T, Container>& operator+=(const Queue<T, Container>& other) {
             this->container += other.container;
             return *this;
         }
 
+        /**
+         * @brief Appends an expiring queue to the current queue, reusing its
+         * elements.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The queue to be appended.
+         * @return A reference to the updated queue.
+         */
+        constexpr Queue<T, Container>& operator+=(Queue<T, Container>&& other) {
+            this->container.append(other.container);
+            return *this;
+        }
+
         /**
          * @brief Checks if two queues are equal.
          *
@@ -194,7 +384,7 @@ namespace own {
          * @param other The queue to be compared.
          * @return true if the queues are equal, false otherwise.
          */
-        bool operator==(const Queue<T>& other) const {
+        constexpr bool operator==(const Queue<T, Container>& other) const {
             return this->container == other.container;
         }
 
@@ -206,7 +396,7 @@ namespace own {
          * @param other The queue to be compared.
          * @return true if the queues are not equal, false otherwise.
          */
-        bool operator!=(const Queue<T>& other) const {
+        constexpr bool operator!=(const Queue<T, Container>& other) const {
             return this->container != other.container;
         }
 
@@ -218,7 +408,23 @@ namespace own {
          * @param other The queue to be assigned.
          * @return A reference to the updated queue.
          */
-        bool operator=(const Queue<T>& other) const { this->container = other.container; }
+        constexpr Queue<T, Container>& operator=(const Queue<T, Container>& other) {
+            this->container = other.container;
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator for Queue, other is left empty.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @param other The queue to be moved.
+         * @return A reference to the updated queue.
+         */
+        constexpr Queue<T, Container>& operator=(Queue<T, Container>&& other) {
+            this->container = std::move(other.container);
+            return *this;
+        }
 
         /**
          * @brief Overloads the << operator for Queue.
@@ -229,7 +435,8 @@ namespace own {
          * @param queue The queue to be outputted.
          * @return The updated output stream.
          */
-        friend std::ostream& operator<<(std::ostream& out, const Queue<T>& queue) {
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const Queue<T, Container>& queue) {
             return out << queue.container;
         }
 
@@ -242,7 +449,7 @@ namespace own {
          * @param queue The queue to be outputted.
          * @return The input stream.
          */
-        friend std::istream& operator>>(std::istream& in, const Queue<T>& queue) {
+        friend std::istream& operator>>(std::istream& in, Queue<T, Container>& queue) {
             return in >> queue.container;
         }
 
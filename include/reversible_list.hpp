@@ -0,0 +1,959 @@
+#ifndef REVERSIBLE_LIST_GUARD_HEADER
+#define REVERSIBLE_LIST_GUARD_HEADER
+
+#include "list.hpp"
+
+// std::equal
+#include <algorithm>
+// std::ostream operator<< overloading
+#include <ostream>
+// std::out_of_range exception
+#include <stdexcept>
+// std::move and std::forward
+#include <utility>
+// std::iterator_traits and std::reverse_iterator
+#include <iterator>
+// std::enable_if and std::is_convertible
+#include <type_traits>
+
+namespace own {
+
+    namespace details {
+
+        /**
+         * @brief A bidirectional iterator walking a list in either direction.
+         *
+         * Walking backwards it behaves as std::reverse_iterator does, the base
+         * iterator points one element past the one being referred to, so the
+         * end of a backward walk is the begin of the list.
+         *
+         * @tparam Base The iterator of the list.
+         */
+        template <typename Base>
+        class DirectedIterator {
+          public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef typename std::iterator_traits<Base>::value_type value_type;
+            typedef typename std::iterator_traits<Base>::difference_type
+                difference_type;
+            typedef typename std::iterator_traits<Base>::pointer pointer;
+            typedef typename std::iterator_traits<Base>::reference reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            DirectedIterator() : _base(), backward(false) {}
+
+            /**
+             * @brief Constructs an iterator from a position of the list.
+             *
+             * Complexity: O(1)
+             *
+             * @param base The position, one past the element if backward.
+             * @param backward True to walk from the back to the front.
+             */
+            DirectedIterator(Base base, bool backward)
+                : _base(base), backward(backward) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename OtherBase,
+                      typename = typename std::enable_if<
+                          std::is_convertible<OtherBase, Base>::value>::type>
+            DirectedIterator(const DirectedIterator<OtherBase>& other)
+                : _base(other.base()), backward(other.isBackward()) {}
+
+            /**
+             * @brief Returns the position of the list the iterator is at.
+             *
+             * Complexity: O(1)
+             *
+             * @return The position, one past the element if the walk is backward.
+             */
+            inline Base base() const { return this->_base; }
+
+            /**
+             * @brief Checks if the iterator walks from the back to the front.
+             *
+             * Complexity: O(1)
+             *
+             * @return True if the walk is backward, false otherwise.
+             */
+            inline bool isBackward() const { return this->backward; }
+
+            // Standard bidirectional iterator operations, all of them O(1).
+
+            inline reference operator*() const {
+                if (this->backward) {
+                    Base it = this->_base;
+                    return *--it;
+                }
+
+                return *this->_base;
+            }
+            inline pointer operator->() const { return &**this; }
+
+            inline DirectedIterator& operator++() {
+                if (this->backward) {
+                    --this->_base;
+                } else {
+                    ++this->_base;
+                }
+                return *this;
+            }
+            inline DirectedIterator operator++(int) {
+                DirectedIterator it = *this;
+                ++*this;
+                return it;
+            }
+            inline DirectedIterator& operator--() {
+                if (this->backward) {
+                    ++this->_base;
+                } else {
+                    --this->_base;
+                }
+                return *this;
+            }
+            inline DirectedIterator operator--(int) {
+                DirectedIterator it = *this;
+                --*this;
+                return it;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend inline bool operator==(const DirectedIterator& a,
+                                          const DirectedIterator& b) {
+                return a._base == b._base;
+            }
+            friend inline bool operator!=(const DirectedIterator& a,
+                                          const DirectedIterator& b) {
+                return a._base != b._base;
+            }
+
+          private:
+            /**
+             * @brief The position of the list.
+             */
+            Base _base;
+            /**
+             * @brief True if the walk is from the back to the front.
+             */
+            bool backward;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A double-linked list that reverses in O(1).
+     *
+     * The nodes are kept in a List, plus a direction flag: reverse() only flips
+     * the flag and every accessor reads the list from the other end while it's
+     * set, the nodes are never touched. Walking through the flag costs a branch
+     * per access, which is why List itself doesn't carry it.
+     *
+     * It provides what Queue and Stack need from their container, so
+     * Queue<T, ReversibleList<T> > switches between FIFO and LIFO in O(1).
+     *
+     * Usage:
+     *
+     *     own::ReversibleList<int> list;
+     *     list.pushBack(1);
+     *     list.pushBack(2);
+     *     list.reverse(); // [2, 1]
+     *
+     * @note Appending a list whose direction differs from this one reverses its
+     * nodes, a chain of doubly linked nodes can only have a single direction.
+     *
+     * @tparam T The type of elements stored in the list.
+     * @tparam Allocator The allocator template used to obtain the nodes, as for List.
+     */
+    template <typename T, template <typename> class Allocator = HeapAllocator>
+    class ReversibleList {
+      public:
+        /**
+         * @brief The list type holding the nodes.
+         */
+        typedef List<T, Allocator> ListType;
+
+        /**
+         * @brief Iterators over the elements of this list, in the current
+         * direction.
+         */
+        typedef details::DirectedIterator<typename ListType::iterator> iterator;
+        typedef details::DirectedIterator<typename ListType::const_iterator>
+            const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Complexity: O(1)
+         */
+        ReversibleList() : reversed(false) {}
+
+        /**
+         * @brief Constructs a list with the elements of the given list, in the same
+         * order.
+         *
+         * Complexity: O(n)
+         *
+         * @param list The list to be copied.
+         */
+        ReversibleList(const ListType& list) : list(list), reversed(false) {}
+
+        /**
+         * @brief Constructs a list taking over the nodes of the given list, in the
+         * same order.
+         *
+         * Complexity: O(1)
+         *
+         * @param list The list to be moved.
+         */
+        ReversibleList(ListType&& list) : list(std::move(list)), reversed(false) {}
+
+        /**
+         * @brief Copy constructor, the direction is copied as well.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to be copied.
+         */
+        ReversibleList(const ReversibleList<T, Allocator>& other)
+            : list(other.list), reversed(other.reversed) {}
+
+        /**
+         * @brief Move constructor, other is left empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be moved.
+         */
+        ReversibleList(ReversibleList<T, Allocator>&& other)
+            : list(std::move(other.list)), reversed(other.reversed) {}
+
+        /**
+         * @brief Checks if the list is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        inline bool empty() const { return this->list.empty(); }
+
+        /**
+         * @brief Returns the length of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the list.
+         */
+        inline usize len() const { return this->list.len(); }
+
+        /**
+         * @brief Checks if the nodes are currently read from the back.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is reversed relative to its nodes.
+         */
+        inline bool isReversed() const { return this->reversed; }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the front element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& front() const {
+            return this->reversed ? this->list.back() : this->list.front();
+        }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the front element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T& front() {
+            return this->reversed ? this->list.back() : this->list.front();
+        }
+
+        /**
+         * @brief Get the value of the back element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the back element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& back() const {
+            return this->reversed ? this->list.front() : this->list.back();
+        }
+
+        /**
+         * @brief Get the value of the back element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the back element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T& back() {
+            return this->reversed ? this->list.front() : this->list.back();
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(1), if at = 0 or at = len - 1
+         * Complexity: O(n), if 0 < at < len - 1
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         * @throws std::out_of_range if the specified position is out of range.
+         */
+        const T& at(usize at) const {
+            if (at >= this->len()) {
+                throw std::out_of_range("ReversibleList::at out of range");
+            }
+
+            return this->list[this->position(at)];
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(1), if at = 0 or at = len - 1
+         * Complexity: O(n), if 0 < at < len - 1
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         * @throws std::out_of_range if the specified position is out of range.
+         */
+        T& at(usize at) {
+            if (at >= this->len()) {
+                throw std::out_of_range("ReversibleList::at out of range");
+            }
+
+            return this->list[this->position(at)];
+        }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline iterator begin() {
+            return iterator(this->reversed ? this->list.end() : this->list.begin(),
+                            this->reversed);
+        }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline const_iterator begin() const {
+            return const_iterator(this->reversed ? this->list.end() : this->list.begin(),
+                                  this->reversed);
+        }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline iterator end() {
+            return iterator(this->reversed ? this->list.begin() : this->list.end(),
+                            this->reversed);
+        }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const {
+            return const_iterator(this->reversed ? this->list.begin() : this->list.end(),
+                                  this->reversed);
+        }
+
+        /**
+         * @brief Returns a const iterator to the first element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to cend() if the list is empty.
+         */
+        inline const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Insert a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushFront(const T& value) {
+            this->emplaceFront(value);
+            return this->begin();
+        }
+
+        /**
+         * @brief Moves a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushFront(T&& value) {
+            this->emplaceFront(std::move(value));
+            return this->begin();
+        }
+
+        /**
+         * @brief Constructs a new element in place at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        inline T& emplaceFront(Args&&... args) {
+            if (this->reversed) {
+                return this->list.emplaceBack(std::forward<Args>(args)...);
+            }
+
+            return this->list.emplaceFront(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes and returns the first element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T popFront() {
+            return this->reversed ? this->list.popBack() : this->list.popFront();
+        }
+
+        /**
+         * @brief Adds an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushBack(const T& value) {
+            this->emplaceBack(value);
+            return --this->end();
+        }
+
+        /**
+         * @brief Moves an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return A cursor to the new element.
+         */
+        inline iterator pushBack(T&& value) {
+            this->emplaceBack(std::move(value));
+            return --this->end();
+        }
+
+        /**
+         * @brief Constructs a new element in place at the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        inline T& emplaceBack(Args&&... args) {
+            if (this->reversed) {
+                return this->list.emplaceFront(std::forward<Args>(args)...);
+            }
+
+            return this->list.emplaceBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes and returns the last element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T popBack() {
+            return this->reversed ? this->list.popFront() : this->list.popBack();
+        }
+
+        /**
+         * @brief Finds the first occurrence of a value in the list.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be found.
+         * @return The index of the first occurrence of the value, or NO_POS if not
+         * found.
+         */
+        usize find(const T& value) const {
+            usize at = 0;
+            for (const_iterator it = this->begin(), end = this->end(); it != end;
+                 ++it, ++at) {
+                if (*it == value) {
+                    return at;
+                }
+            }
+
+            return NO_POS;
+        }
+
+        /**
+         * @brief Checks if the list contains a value.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be checked.
+         * @return True if the list contains the value, false otherwise.
+         */
+        inline bool contains(const T& value) const { return this->list.contains(value); }
+
+        /**
+         * @brief Appends another list to the end of the current list, taking over
+         * its nodes.
+         *
+         * Complexity: O(1), if both lists share the direction and the allocator
+         * Complexity: O(m), otherwise, as the nodes of other are reversed or copied
+         *
+         * @param other The list to be appended, it's left empty.
+         */
+        void append(ReversibleList<T, Allocator>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            if (other.reversed != this->reversed) {
+                other.list.reverse();
+            }
+
+            if (this->reversed) {
+                this->list.splice(this->list.begin(), other.list);
+            } else {
+                this->list.append(other.list);
+            }
+
+            other.reversed = false;
+        }
+
+        /**
+         * @brief Appends an expiring list to the end of the current list.
+         *
+         * Complexity: O(1), if both lists share the direction and the allocator
+         *
+         * @param other The list to be appended.
+         */
+        inline void append(ReversibleList<T, Allocator>&& other) { this->append(other); }
+
+        /**
+         * @brief Reverses the order of the elements by flipping the direction, the
+         * nodes are not touched.
+         *
+         * Complexity: O(1)
+         */
+        inline void reverse() { this->reversed = !this->reversed; }
+
+        /**
+         * @brief Removes all elements from the list.
+         *
+         * Complexity: O(n)
+         */
+        void clear() {
+            this->list.clear();
+            this->reversed = false;
+        }
+
+        /**
+         * @brief Swaps the contents and the direction of this list with another list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to swap with.
+         */
+        void swap(ReversibleList<T, Allocator>& other) {
+            this->list.swap(other.list);
+            std::swap(this->reversed, other.reversed);
+        }
+
+        /**
+         * @brief Applies the given action to each element, from the front to the
+         * back.
+         *
+         * Complexity: O(n)
+         *
+         * @param action The callable to apply to each element.
+         * @tparam Action The callable data-type
+         */
+        template <typename Action>
+        void forEach(Action action) const {
+            for (const_iterator it = this->begin(), end = this->end(); it != end; ++it) {
+                action(*it);
+            }
+        }
+
+        /**
+         * @brief Applies the given action to each element, from the front to the
+         * back.
+         *
+         * Complexity: O(n)
+         *
+         * @param action The callable to apply to each element.
+         * @tparam Action The callable data-type
+         */
+        template <typename Action>
+        void forEach(Action action) {
+            for (iterator it = this->begin(), end = this->end(); it != end; ++it) {
+                action(*it);
+            }
+        }
+
+        /**
+         * @brief Folds the elements from the front to the back.
+         *
+         * Complexity: O(n)
+         *
+         * @param action The callable taking the element and B&.
+         * @param initial The initial value of the accumulator.
+         * @return The folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) const {
+            for (const_iterator it = this->begin(), end = this->end(); it != end; ++it) {
+                action(*it, initial);
+            }
+
+            return initial;
+        }
+
+        /**
+         * @brief Converts the list into a List in the current order.
+         *
+         * Complexity: O(n)
+         *
+         * @return A List containing the elements of this list.
+         */
+        ListType intoList() const& {
+            ListType list(this->list);
+            if (this->reversed) {
+                list.reverse();
+            }
+
+            return list;
+        }
+
+        /**
+         * @brief Converts an expiring list into a List in the current order, the
+         * nodes are taken over.
+         *
+         * Complexity: O(1), if the list is not reversed
+         * Complexity: O(n), otherwise, as the nodes are reversed
+         *
+         * @return A List containing the elements of this list.
+         */
+        ListType intoList() && {
+            if (this->reversed) {
+                this->list.reverse();
+                this->reversed = false;
+            }
+
+            return std::move(this->list);
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(1), if at = 0 or at = len - 1
+         * Complexity: O(n), if 0 < at < len - 1
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        inline const T& operator[](usize at) const {
+            return this->list[this->position(at)];
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(1), if at = 0 or at = len - 1
+         * Complexity: O(n), if 0 < at < len - 1
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        inline T& operator[](usize at) { return this->list[this->position(at)]; }
+
+        /**
+         * @brief Concatenates this list with another list and returns a new list.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to concatenate with.
+         * @return A new list that contains elements from both lists.
+         */
+        ReversibleList<T, Allocator>
+        operator+(const ReversibleList<T, Allocator>& other) const& {
+            ReversibleList<T, Allocator> newList(*this);
+            newList += other;
+            return newList;
+        }
+
+        /**
+         * @brief Concatenates two expiring lists by relinking their nodes.
+         *
+         * Complexity: O(1), if both lists share the direction and the allocator
+         *
+         * @param other The list to concatenate with.
+         * @return A new list that contains elements from both lists.
+         */
+        ReversibleList<T, Allocator> operator+(ReversibleList<T, Allocator>&& other) && {
+            this->append(other);
+            return std::move(*this);
+        }
+
+        /**
+         * @brief Appends the elements of another list to this list.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The list to append.
+         * @return A reference to this list after the append operation.
+         */
+        ReversibleList<T, Allocator>&
+        operator+=(const ReversibleList<T, Allocator>& other) {
+            usize len = other.len();
+            const_iterator it = other.begin();
+            // other may be this list, only its former elements are appended
+            for (usize i = 0; i < len; i++, ++it) {
+                this->pushBack(*it);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Appends an expiring list to this list, taking over its nodes.
+         *
+         * Complexity: O(1), if both lists share the direction and the allocator
+         *
+         * @param other The list to append.
+         * @return A reference to this list after the append operation.
+         */
+        ReversibleList<T, Allocator>& operator+=(ReversibleList<T, Allocator>&& other) {
+            this->append(other);
+            return *this;
+        }
+
+        /**
+         * @brief Checks if two lists hold the same elements in the same order, the
+         * directions of the nodes may differ.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are equal, false otherwise.
+         */
+        bool operator==(const ReversibleList<T, Allocator>& other) const {
+            if (this->reversed == other.reversed) {
+                return this->list == other.list;
+            }
+
+            return this->len() == other.len() &&
+                   std::equal(this->begin(), this->end(), other.begin());
+        }
+
+        /**
+         * @brief Checks if two lists differ.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are not equal, false otherwise.
+         */
+        bool operator!=(const ReversibleList<T, Allocator>& other) const {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Overloads the assignment operator, the direction is copied as well.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to assign from.
+         * @return A reference to this list.
+         */
+        ReversibleList<T, Allocator>&
+        operator=(const ReversibleList<T, Allocator>& other) {
+            this->list = other.list;
+            this->reversed = other.reversed;
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the move assignment operator, other is left empty.
+         *
+         * Complexity: O(n), as the current nodes are freed
+         *
+         * @param other The list to move from.
+         * @return A reference to this list.
+         */
+        ReversibleList<T, Allocator>& operator=(ReversibleList<T, Allocator>&& other) {
+            this->list = std::move(other.list);
+            this->reversed = other.reversed;
+            return *this;
+        }
+
+        /**
+         * @brief Prints the list from the front to the back, as List does.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param list The list to print.
+         * @return The output stream after printing the list.
+         */
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const ReversibleList<T, Allocator>& list) {
+            out << '[';
+
+            const_iterator it = list.begin();
+            const_iterator end = list.end();
+            if (it != end) {
+                out << *it;
+
+                for (++it; it != end; ++it) {
+                    out << ", " << *it;
+                }
+            }
+
+            out << ']';
+            return out;
+        }
+
+      private:
+        /**
+         * @brief Maps a position in the current direction to the position of the
+         * node in the list.
+         *
+         * Complexity: O(1)
+         */
+        inline usize position(usize at) const {
+            return this->reversed ? this->list.len() - 1 - at : at;
+        }
+
+      private:
+        /**
+         * @brief The nodes, in their own direction.
+         */
+        ListType list;
+        /**
+         * @brief True if the list is read from the back of the nodes.
+         */
+        bool reversed;
+    };
+
+} // namespace own
+
+#endif // REVERSIBLE_LIST_GUARD_HEADER
@@ -0,0 +1,1534 @@
+#ifndef RING_BUFFER_GUARD_HEADER
+#define RING_BUFFER_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::swap
+#include <algorithm>
+// std::out_of_range and std::length_error exceptions
+#include <stdexcept>
+// std::move and std::forward
+#include <utility>
+// placement new
+#include <new>
+
+namespace own {
+
+    /**
+     * @brief Capacity of a growable ring buffer after its first allocation.
+     */
+    const usize RING_BUFFER_MIN_CAPACITY = 8;
+
+    namespace details {
+
+        /**
+         * @brief Element management shared by every ring buffer.
+         *
+         * The elements live in a contiguous power of two storage which is owned by
+         * the derived class, the base only knows how to construct, access and destroy
+         * them through ring indexing.
+         *
+         * @tparam T The type of the elements.
+         */
+        template <typename T>
+        class RingBase {
+          public:
+            /**
+             * @brief Iterators over the elements of the ring, from front to back.
+             */
+            typedef IndexIterator<RingBase<T>, T> iterator;
+            typedef IndexIterator<const RingBase<T>, const T> const_iterator;
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+            /**
+             * @brief Checks if the ring is empty.
+             *
+             * Complexity: O(1)
+             *
+             * @return True if the ring is empty, false otherwise.
+             */
+            inline bool empty() const { return this->_len == 0; }
+
+            /**
+             * @brief Returns the amount of elements in the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return The length of the ring.
+             */
+            inline usize len() const { return this->_len; }
+
+            /**
+             * @brief Returns how many elements fit before the storage is exhausted.
+             *
+             * Complexity: O(1)
+             *
+             * @return The capacity of the ring.
+             */
+            inline usize capacity() const { return this->_capacity; }
+
+            /**
+             * @brief Checks if the storage is exhausted.
+             *
+             * Complexity: O(1)
+             *
+             * @return True if the ring is full, false otherwise.
+             */
+            inline bool full() const { return this->_len == this->_capacity; }
+
+            /**
+             * @brief Get the value of the front element of the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return A reference to the value of the front element.
+             *
+             * @note it's undefined behavior if ring is empty.
+             */
+            inline const T& front() const { return *this->slot(0); }
+
+            /**
+             * @brief Get the value of the front element of the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return A reference to the value of the front element.
+             *
+             * @note it's undefined behavior if ring is empty.
+             */
+            inline T& front() { return *this->slot(0); }
+
+            /**
+             * @brief Get the value of the back element of the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return A reference to the value of the back element.
+             *
+             * @note it's undefined behavior if ring is empty.
+             */
+            inline const T& back() const { return *this->slot(this->_len - 1); }
+
+            /**
+             * @brief Get the value of the back element of the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return A reference to the value of the back element.
+             *
+             * @note it's undefined behavior if ring is empty.
+             */
+            inline T& back() { return *this->slot(this->_len - 1); }
+
+            /**
+             * @brief Returns an iterator to the first element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator, equal to end() if the ring is empty.
+             */
+            inline iterator begin() { return iterator(this, 0); }
+
+            /**
+             * @brief Returns an iterator to the first element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator, equal to end() if the ring is empty.
+             */
+            inline const_iterator begin() const { return const_iterator(this, 0); }
+
+            /**
+             * @brief Returns an iterator past the last element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator.
+             */
+            inline iterator end() { return iterator(this, this->_len); }
+
+            /**
+             * @brief Returns an iterator past the last element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator.
+             */
+            inline const_iterator end() const { return const_iterator(this, this->_len); }
+
+            /**
+             * @brief Returns a const iterator to the first element, even if the ring is
+             * mutable.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator, equal to cend() if the ring is empty.
+             */
+            inline const_iterator cbegin() const { return this->begin(); }
+
+            /**
+             * @brief Returns a const iterator past the last element, even if the ring is
+             * mutable.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator.
+             */
+            inline const_iterator cend() const { return this->end(); }
+
+            /**
+             * @brief Returns a reverse iterator to the last element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator, equal to rend() if the ring is empty.
+             */
+            inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+            /**
+             * @brief Returns a reverse iterator to the last element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator, equal to rend() if the ring is empty.
+             */
+            inline const_reverse_iterator rbegin() const {
+                return const_reverse_iterator(this->end());
+            }
+
+            /**
+             * @brief Returns a reverse iterator before the first element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator.
+             */
+            inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+            /**
+             * @brief Returns a reverse iterator before the first element.
+             *
+             * Complexity: O(1)
+             *
+             * @return The iterator.
+             */
+            inline const_reverse_iterator rend() const {
+                return const_reverse_iterator(this->begin());
+            }
+
+            /**
+             * @brief Get the value of the element at the specified position.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position of the element.
+             * @return A reference to the value of the element at the specified position.
+             * @throws std::out_of_range if the specified position is out of range.
+             */
+            const T& at(usize at) const {
+                if (at >= this->_len) {
+                    throw std::out_of_range("RingBuffer::at out of range");
+                }
+
+                return *this->slot(at);
+            }
+
+            /**
+             * @brief Get the value of the element at the specified position.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position of the element.
+             * @return A reference to the value of the element at the specified position.
+             * @throws std::out_of_range if the specified position is out of range.
+             */
+            T& at(usize at) {
+                if (at >= this->_len) {
+                    throw std::out_of_range("RingBuffer::at out of range");
+                }
+
+                return *this->slot(at);
+            }
+
+            /**
+             * @brief Returns a reference to the element at the specified position.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position of the element to access.
+             * @return A const reference to the element at the specified position.
+             *
+             * @note it's undefined behavior if at is out of range.
+             */
+            inline const T& operator[](usize at) const { return *this->slot(at); }
+
+            /**
+             * @brief Returns a reference to the element at the specified position.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position of the element to access.
+             * @return A reference to the element at the specified position.
+             *
+             * @note it's undefined behavior if at is out of range.
+             */
+            inline T& operator[](usize at) { return *this->slot(at); }
+
+            /**
+             * @brief Removes and returns the first element of the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return The value of the removed element.
+             *
+             * @note it's undefined behavior if ring is empty.
+             */
+            T popFront() {
+                T* ptr = this->slot(0);
+                T value = std::move(*ptr);
+                ptr->~T();
+
+                this->head = (this->head + 1) & (this->_capacity - 1);
+                this->_len--;
+
+                return value;
+            }
+
+            /**
+             * @brief Removes and returns the last element of the ring.
+             *
+             * Complexity: O(1)
+             *
+             * @return The value of the removed element.
+             *
+             * @note it's undefined behavior if ring is empty.
+             */
+            T popBack() {
+                T* ptr = this->slot(this->_len - 1);
+                T value = std::move(*ptr);
+                ptr->~T();
+
+                this->_len--;
+
+                return value;
+            }
+
+            /**
+             * @brief Reverses the order of elements in the ring.
+             *
+             * Complexity: O(n)
+             */
+            void reverse() {
+                if (this->_len < 2) {
+                    return;
+                }
+
+                for (usize i = 0, j = this->_len - 1; i < j; i++, j--) {
+                    std::swap(*this->slot(i), *this->slot(j));
+                }
+            }
+
+            /**
+             * @brief Destroys every element, the storage is kept.
+             *
+             * Complexity: O(n)
+             */
+            void clear() {
+                for (usize i = 0; i < this->_len; i++) {
+                    this->slot(i)->~T();
+                }
+
+                this->head = 0;
+                this->_len = 0;
+            }
+
+            /**
+             * @brief Checks if two rings hold the same elements in the same order.
+             *
+             * Complexity: O(n)
+             *
+             * @param other The ring to compare with.
+             * @return True if the rings are equal, false otherwise.
+             */
+            bool operator==(const RingBase<T>& other) const {
+                if (this == &other) {
+                    return true;
+                }
+                if (this->_len != other._len) {
+                    return false;
+                }
+
+                for (usize i = 0; i < this->_len; i++) {
+                    if (!(*this->slot(i) == *other.slot(i))) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Checks if two rings are not equal.
+             *
+             * Complexity: O(n)
+             *
+             * @param other The ring to compare with.
+             * @return True if the rings are not equal, false otherwise.
+             */
+            inline bool operator!=(const RingBase<T>& other) const {
+                return !(*this == other);
+            }
+
+            /**
+             * @brief Overloads the output stream operator to print the ring as a string
+             * representation.
+             *
+             * Complexity: O(n)
+             *
+             * @param out The output stream.
+             * @param ring The ring to print.
+             * @return The output stream after printing the ring.
+             */
+            friend std::ostream& operator<<(std::ostream& out, const RingBase<T>& ring) {
+                return details::writeSequence(out, ring);
+            }
+
+          protected:
+            /**
+             * @brief Constructs an empty ring over the given storage.
+             *
+             * Complexity: O(1)
+             *
+             * @param data The storage, it must fit capacity elements.
+             * @param capacity A power of two, or 0 if there's no storage yet.
+             */
+            RingBase(T* data, usize capacity) {
+                this->data = data;
+                this->_capacity = capacity;
+                this->head = 0;
+                this->_len = 0;
+            }
+
+            /**
+             * @brief Returns the storage of the element at the specified position.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position, it can go up to capacity.
+             * @return A pointer to the storage.
+             */
+            inline T* slot(usize at) const {
+                return this->data + ((this->head + at) & (this->_capacity - 1));
+            }
+
+            /**
+             * @brief Constructs a new element after the back element.
+             *
+             * Complexity: O(1)
+             *
+             * @param args The arguments forwarded to the constructor of T.
+             * @return A reference to the new element.
+             *
+             * @note it's undefined behavior if ring is full.
+             */
+            template <typename... Args>
+            inline T& constructBack(Args&&... args) {
+                T* ptr = new (this->slot(this->_len)) T(std::forward<Args>(args)...);
+                this->_len++;
+                return *ptr;
+            }
+
+            /**
+             * @brief Constructs a new element before the front element.
+             *
+             * Complexity: O(1)
+             *
+             * @param args The arguments forwarded to the constructor of T.
+             * @return A reference to the new element.
+             *
+             * @note it's undefined behavior if ring is full.
+             */
+            template <typename... Args>
+            inline T& constructFront(Args&&... args) {
+                usize head = (this->head - 1) & (this->_capacity - 1);
+                T* ptr = new (this->data + head) T(std::forward<Args>(args)...);
+                this->head = head;
+                this->_len++;
+                return *ptr;
+            }
+
+            /**
+             * @brief Moves every element, in order, into a linear storage and
+             * destroys the originals.
+             *
+             * The ring is relocated as its two contiguous segments, so it moves
+             * the same way Vector does.
+             *
+             * Complexity: O(n)
+             *
+             * @param dest The storage, it must fit len elements and not overlap
+             * the ring.
+             */
+            void relocate(T* dest) {
+                usize first = this->_capacity - this->head;
+                if (first > this->_len) {
+                    first = this->_len;
+                }
+
+                details::relocate(dest, this->data + this->head, first);
+                details::relocate(dest + first, this->data, this->_len - first);
+
+                this->head = 0;
+            }
+
+          protected:
+            /**
+             * @brief The storage of the elements.
+             */
+            T* data;
+            /**
+             * @brief The capacity of the storage, a power of two.
+             */
+            usize _capacity;
+            /**
+             * @brief Storage index of the front element.
+             */
+            usize head;
+            /**
+             * @brief The amount of elements.
+             */
+            usize _len;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A growable ring buffer, elements are stored contiguously in a power of
+     * two storage which doubles whenever it's exhausted.
+     *
+     * It provides the same surface as List for the Queue adapter, so
+     * `Queue<T, RingBuffer<T> >` pushes and pops with no allocation per element.
+     *
+     * @tparam T The type of elements stored in the ring.
+     */
+    template <typename T>
+    class RingBuffer : public details::RingBase<T> {
+      public:
+        /**
+         * @brief Default constructor, no storage is allocated until the first push.
+         *
+         * Complexity: O(1)
+         */
+        RingBuffer() : details::RingBase<T>(NULL, 0) {}
+
+        /**
+         * @brief Constructs an empty ring with storage for at least capacity
+         * elements.
+         *
+         * Complexity: O(1)
+         *
+         * @param capacity The minimum capacity, it's rounded up to a power of two.
+         */
+        explicit RingBuffer(usize capacity) : details::RingBase<T>(NULL, 0) {
+            this->reserve(capacity);
+        }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The ring to be copied.
+         */
+        RingBuffer(const RingBuffer<T>& other) : details::RingBase<T>(NULL, 0) {
+            *this += other;
+        }
+
+        /**
+         * @brief Move constructor, takes over the storage of other which is left
+         * empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The ring to be moved.
+         */
+        RingBuffer(RingBuffer<T>&& other) : details::RingBase<T>(NULL, 0) {
+            this->swap(other);
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Complexity: O(n)
+         */
+        ~RingBuffer() {
+            this->clear();
+            ::operator delete(this->data);
+        }
+
+        /**
+         * @brief Ensures that at least capacity elements fit without growing.
+         *
+         * Complexity: O(n), if the storage has to grow
+         * Complexity: O(1), otherwise
+         *
+         * @param capacity The minimum capacity, it's rounded up to a power of two.
+         */
+        void reserve(usize capacity) {
+            if (capacity <= this->_capacity) {
+                return;
+            }
+
+            capacity = details::nextPowerOfTwo(capacity);
+
+            T* data = static_cast<T*>(::operator new(sizeof(T) * capacity));
+            this->relocate(data);
+
+            ::operator delete(this->data);
+            this->data = data;
+            this->_capacity = capacity;
+        }
+
+        /**
+         * @brief Inserts a new element at the front of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(const T& value) { this->emplaceFront(value); }
+
+        /**
+         * @brief Moves a new element at the front of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(T&& value) { this->emplaceFront(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the front of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            if (this->full()) {
+                // args may live in the storage that is about to be released
+                T value(std::forward<Args>(args)...);
+                this->grow();
+                return this->constructFront(std::move(value));
+            }
+
+            return this->constructFront(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Adds an element to the end of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(const T& value) { this->emplaceBack(value); }
+
+        /**
+         * @brief Moves an element to the end of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the end of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            if (this->full()) {
+                // args may live in the storage that is about to be released
+                T value(std::forward<Args>(args)...);
+                this->grow();
+                return this->constructBack(std::move(value));
+            }
+
+            return this->constructBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this ring, other is left
+         * empty.
+         *
+         * Complexity: O(1), if this ring is empty
+         * Complexity: O(m), otherwise
+         *
+         * @param other The ring to be appended.
+         */
+        void append(RingBuffer<T>& other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            if (this->empty()) {
+                this->swap(other);
+                return;
+            }
+
+            this->reserve(this->_len + other._len);
+            while (!other.empty()) {
+                this->constructBack(other.popFront());
+            }
+        }
+
+        /**
+         * @brief Swaps the contents of this ring with another ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The ring to swap with.
+         */
+        void swap(RingBuffer<T>& other) {
+            std::swap(this->data, other.data);
+            std::swap(this->_capacity, other._capacity);
+            std::swap(this->head, other.head);
+            std::swap(this->_len, other._len);
+        }
+
+        /**
+         * @brief Concatenates this ring with another ring and returns a new ring.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to concatenate with.
+         * @return A new ring that contains elements from both rings.
+         */
+        RingBuffer<T> operator+(const RingBuffer<T>& other) const {
+            RingBuffer<T> ring(this->_len + other._len);
+            ring += *this;
+            ring += other;
+            return ring;
+        }
+
+        /**
+         * @brief Appends a copy of the elements of another ring to this ring.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The ring to append.
+         * @return A reference to this ring after the append operation.
+         */
+        RingBuffer<T>& operator+=(const RingBuffer<T>& other) {
+            if (this == &other) {
+                RingBuffer<T> copy(other);
+                return *this += copy;
+            }
+
+            this->reserve(this->_len + other._len);
+            for (usize i = 0; i < other._len; i++) {
+                this->constructBack(other[i]);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Assigns a copy of the contents of another ring to this ring.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to assign from.
+         * @return A reference to this ring.
+         */
+        RingBuffer<T>& operator=(const RingBuffer<T>& other) {
+            if (this != &other) {
+                this->clear();
+                *this += other;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Takes over the storage of another ring, which is left empty.
+         *
+         * Complexity: O(n), as the current elements are destroyed
+         *
+         * @param other The ring to move from.
+         * @return A reference to this ring.
+         */
+        RingBuffer<T>& operator=(RingBuffer<T>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->swap(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the ring from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param ring The ring to fill.
+         * @return The input stream.
+         */
+        friend std::istream& operator>>(std::istream& in, RingBuffer<T>& ring) {
+            return details::readSequence<T>(in, ring);
+        }
+
+      private:
+        /**
+         * @brief Doubles the capacity of the storage.
+         *
+         * Complexity: O(n)
+         */
+        inline void grow() {
+            this->reserve(this->_capacity > 0 ? this->_capacity * 2
+                                              : RING_BUFFER_MIN_CAPACITY);
+        }
+    };
+
+    /**
+     * @brief A ring buffer with inline storage for N elements which never allocates.
+     *
+     * It's meant for latency-critical paths, pushing into a full ring throws
+     * std::length_error, tryPushBack and tryPushFront report it instead.
+     *
+     * @tparam T The type of elements stored in the ring.
+     * @tparam N The capacity of the ring, it must be a power of two.
+     */
+    template <typename T, usize N>
+    class FixedRingBuffer : public details::RingBase<T> {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of two");
+
+      public:
+        /**
+         * @brief Default constructor.
+         *
+         * Complexity: O(1)
+         */
+        FixedRingBuffer() : details::RingBase<T>(this->storage(), N) {}
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The ring to be copied.
+         */
+        FixedRingBuffer(const FixedRingBuffer<T, N>& other)
+            : details::RingBase<T>(this->storage(), N) {
+            *this += other;
+        }
+
+        /**
+         * @brief Move constructor, the elements of other are moved one by one and
+         * other is left empty.
+         *
+         * Complexity: O(n), as the storage is inline
+         *
+         * @param other The ring to be moved.
+         */
+        FixedRingBuffer(FixedRingBuffer<T, N>&& other)
+            : details::RingBase<T>(this->storage(), N) {
+            this->append(other);
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Complexity: O(n)
+         */
+        ~FixedRingBuffer() { this->clear(); }
+
+        /**
+         * @brief Tries to insert a new element at the front of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return False if the ring was full, true otherwise.
+         */
+        bool tryPushFront(const T& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->constructFront(value);
+            return true;
+        }
+
+        /**
+         * @brief Tries to move a new element at the front of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return False if the ring was full, true otherwise.
+         */
+        bool tryPushFront(T&& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->constructFront(std::move(value));
+            return true;
+        }
+
+        /**
+         * @brief Tries to add an element to the end of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return False if the ring was full, true otherwise.
+         */
+        bool tryPushBack(const T& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->constructBack(value);
+            return true;
+        }
+
+        /**
+         * @brief Tries to move an element to the end of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return False if the ring was full, true otherwise.
+         */
+        bool tryPushBack(T&& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->constructBack(std::move(value));
+            return true;
+        }
+
+        /**
+         * @brief Inserts a new element at the front of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @throws std::length_error if the ring is full.
+         */
+        void pushFront(const T& value) {
+            if (!this->tryPushFront(value)) {
+                throw std::length_error("FixedRingBuffer::pushFront ring is full");
+            }
+        }
+
+        /**
+         * @brief Moves a new element at the front of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @throws std::length_error if the ring is full.
+         */
+        void pushFront(T&& value) {
+            if (!this->tryPushFront(std::move(value))) {
+                throw std::length_error("FixedRingBuffer::pushFront ring is full");
+            }
+        }
+
+        /**
+         * @brief Adds an element to the end of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @throws std::length_error if the ring is full.
+         */
+        void pushBack(const T& value) {
+            if (!this->tryPushBack(value)) {
+                throw std::length_error("FixedRingBuffer::pushBack ring is full");
+            }
+        }
+
+        /**
+         * @brief Moves an element to the end of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @throws std::length_error if the ring is full.
+         */
+        void pushBack(T&& value) {
+            if (!this->tryPushBack(std::move(value))) {
+                throw std::length_error("FixedRingBuffer::pushBack ring is full");
+            }
+        }
+
+        /**
+         * @brief Constructs a new element in place at the front of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::length_error if the ring is full.
+         */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            if (this->full()) {
+                throw std::length_error("FixedRingBuffer::emplaceFront ring is full");
+            }
+
+            return this->constructFront(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Constructs a new element in place at the end of the ring.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::length_error if the ring is full.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            if (this->full()) {
+                throw std::length_error("FixedRingBuffer::emplaceBack ring is full");
+            }
+
+            return this->constructBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this ring, other is left
+         * empty.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The ring to be appended.
+         * @throws std::length_error if both rings don't fit together, nothing is
+         * moved in that case.
+         */
+        void append(FixedRingBuffer<T, N>& other) {
+            if (this == &other) {
+                return;
+            }
+            if (this->_len + other._len > N) {
+                throw std::length_error("FixedRingBuffer::append ring is full");
+            }
+
+            while (!other.empty()) {
+                this->constructBack(other.popFront());
+            }
+        }
+
+        /**
+         * @brief Swaps the contents of this ring with another ring.
+         *
+         * Complexity: O(n + m), as the storage is inline
+         *
+         * @param other The ring to swap with.
+         */
+        void swap(FixedRingBuffer<T, N>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            FixedRingBuffer<T, N> tmp;
+            tmp.append(other);
+            other.append(*this);
+            this->append(tmp);
+        }
+
+        /**
+         * @brief Concatenates this ring with another ring and returns a new ring.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to concatenate with.
+         * @return A new ring that contains elements from both rings.
+         * @throws std::length_error if both rings don't fit together.
+         */
+        FixedRingBuffer<T, N> operator+(const FixedRingBuffer<T, N>& other) const {
+            FixedRingBuffer<T, N> ring(*this);
+            ring += other;
+            return ring;
+        }
+
+        /**
+         * @brief Appends a copy of the elements of another ring to this ring.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The ring to append.
+         * @return A reference to this ring after the append operation.
+         * @throws std::length_error if both rings don't fit together, nothing is
+         * copied in that case.
+         */
+        FixedRingBuffer<T, N>& operator+=(const FixedRingBuffer<T, N>& other) {
+            if (this->_len + other._len > N) {
+                throw std::length_error("FixedRingBuffer::operator+= ring is full");
+            }
+
+            usize len = other._len;
+            for (usize i = 0; i < len; i++) {
+                this->constructBack(other[i]);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Assigns a copy of the contents of another ring to this ring.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to assign from.
+         * @return A reference to this ring.
+         */
+        FixedRingBuffer<T, N>& operator=(const FixedRingBuffer<T, N>& other) {
+            if (this != &other) {
+                this->clear();
+                *this += other;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Moves the elements of another ring into this ring, other is left
+         * empty.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to move from.
+         * @return A reference to this ring.
+         */
+        FixedRingBuffer<T, N>& operator=(FixedRingBuffer<T, N>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->append(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the ring from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param ring The ring to fill.
+         * @return The input stream.
+         * @throws std::length_error if the ring gets full.
+         */
+        friend std::istream& operator>>(std::istream& in, FixedRingBuffer<T, N>& ring) {
+            return details::readSequence<T>(in, ring);
+        }
+
+      private:
+        /**
+         * @brief Returns the inline storage.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the first element of the storage.
+         */
+        inline T* storage() { return reinterpret_cast<T*>(this->buffer); }
+
+      private:
+        /**
+         * @brief The inline storage.
+         */
+        alignas(T) unsigned char buffer[sizeof(T) * N];
+    };
+
+    /**
+     * @brief A growable ring buffer with inline storage for the first K elements,
+     * it only allocates once more than K elements are held at the same time.
+     *
+     * Small queues and stacks are the common case, so `Queue<T, SmallRingBuffer<T> >`
+     * and `Stack<T, SmallRingBuffer<T> >` usually never touch the allocator. Past K
+     * it behaves as RingBuffer does, the storage doubles whenever it's exhausted and
+     * is kept until the destructor.
+     *
+     * @note Moving or swapping a ring whose elements are still inline moves them
+     * one by one, a spilled ring hands its storage over in O(1).
+     *
+     * @tparam T The type of elements stored in the ring.
+     * @tparam K The inline capacity, it must be a power of two.
+     */
+    template <typename T, usize K = RING_BUFFER_MIN_CAPACITY>
+    class SmallRingBuffer : public details::RingBase<T> {
+        static_assert(K > 0 && (K & (K - 1)) == 0, "K must be a power of two");
+
+      public:
+        /**
+         * @brief Default constructor, the inline storage is used.
+         *
+         * Complexity: O(1)
+         */
+        SmallRingBuffer() : details::RingBase<T>(this->storage(), K) {}
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The ring to be copied.
+         */
+        SmallRingBuffer(const SmallRingBuffer<T, K>& other)
+            : details::RingBase<T>(this->storage(), K) {
+            *this += other;
+        }
+
+        /**
+         * @brief Move constructor, other is left empty.
+         *
+         * Complexity: O(1), if other has spilled to the heap
+         * Complexity: O(n), otherwise, as the elements are inline
+         *
+         * @param other The ring to be moved.
+         */
+        SmallRingBuffer(SmallRingBuffer<T, K>&& other)
+            : details::RingBase<T>(this->storage(), K) {
+            this->takeOver(other);
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Complexity: O(n)
+         */
+        ~SmallRingBuffer() {
+            this->clear();
+            this->release();
+        }
+
+        /**
+         * @brief Checks if the elements are still in the inline storage.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the ring never spilled to the heap, false otherwise.
+         */
+        inline bool isInline() const { return this->data == this->storage(); }
+
+        /**
+         * @brief Ensures that at least capacity elements fit without growing.
+         *
+         * Complexity: O(n), if the storage has to grow
+         * Complexity: O(1), otherwise
+         *
+         * @param capacity The minimum capacity, it's rounded up to a power of two.
+         */
+        void reserve(usize capacity) {
+            if (capacity <= this->_capacity) {
+                return;
+            }
+
+            capacity = details::nextPowerOfTwo(capacity);
+
+            T* data = static_cast<T*>(::operator new(sizeof(T) * capacity));
+            this->relocate(data);
+
+            this->release();
+            this->data = data;
+            this->_capacity = capacity;
+        }
+
+        /**
+         * @brief Inserts a new element at the front of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(const T& value) { this->emplaceFront(value); }
+
+        /**
+         * @brief Moves a new element at the front of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(T&& value) { this->emplaceFront(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the front of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            if (this->full()) {
+                // args may live in the storage that is about to be released
+                T value(std::forward<Args>(args)...);
+                this->reserve(this->_capacity * 2);
+                return this->constructFront(std::move(value));
+            }
+
+            return this->constructFront(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Adds an element to the end of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(const T& value) { this->emplaceBack(value); }
+
+        /**
+         * @brief Moves an element to the end of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the end of the ring.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            if (this->full()) {
+                // args may live in the storage that is about to be released
+                T value(std::forward<Args>(args)...);
+                this->reserve(this->_capacity * 2);
+                return this->constructBack(std::move(value));
+            }
+
+            return this->constructBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this ring, other is left
+         * empty.
+         *
+         * Complexity: O(1), if this ring is empty and other has spilled to the heap
+         * Complexity: O(m), otherwise
+         *
+         * @param other The ring to be appended.
+         */
+        void append(SmallRingBuffer<T, K>& other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            if (this->empty()) {
+                this->takeOver(other);
+                return;
+            }
+
+            this->reserve(this->_len + other._len);
+            while (!other.empty()) {
+                this->constructBack(other.popFront());
+            }
+        }
+
+        /**
+         * @brief Swaps the contents of this ring with another ring.
+         *
+         * Complexity: O(1), if both rings have spilled to the heap
+         * Complexity: O(n + m), otherwise
+         *
+         * @param other The ring to swap with.
+         */
+        void swap(SmallRingBuffer<T, K>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            if (!this->isInline() && !other.isInline()) {
+                std::swap(this->data, other.data);
+                std::swap(this->_capacity, other._capacity);
+                std::swap(this->head, other.head);
+                std::swap(this->_len, other._len);
+                return;
+            }
+
+            SmallRingBuffer<T, K> tmp(std::move(other));
+            other.takeOver(*this);
+            this->takeOver(tmp);
+        }
+
+        /**
+         * @brief Concatenates this ring with another ring and returns a new ring.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to concatenate with.
+         * @return A new ring that contains elements from both rings.
+         */
+        SmallRingBuffer<T, K> operator+(const SmallRingBuffer<T, K>& other) const {
+            SmallRingBuffer<T, K> ring;
+            ring.reserve(this->_len + other._len);
+            ring += *this;
+            ring += other;
+            return ring;
+        }
+
+        /**
+         * @brief Appends a copy of the elements of another ring to this ring.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The ring to append.
+         * @return A reference to this ring after the append operation.
+         */
+        SmallRingBuffer<T, K>& operator+=(const SmallRingBuffer<T, K>& other) {
+            if (this == &other) {
+                SmallRingBuffer<T, K> copy(other);
+                return *this += copy;
+            }
+
+            this->reserve(this->_len + other._len);
+            for (usize i = 0; i < other._len; i++) {
+                this->constructBack(other[i]);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Assigns a copy of the contents of another ring to this ring.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The ring to assign from.
+         * @return A reference to this ring.
+         */
+        SmallRingBuffer<T, K>& operator=(const SmallRingBuffer<T, K>& other) {
+            if (this != &other) {
+                this->clear();
+                *this += other;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Moves the contents of another ring into this ring, other is left
+         * empty.
+         *
+         * Complexity: O(n), if other has spilled to the heap
+         * Complexity: O(n + m), otherwise
+         *
+         * @param other The ring to move from.
+         * @return A reference to this ring.
+         */
+        SmallRingBuffer<T, K>& operator=(SmallRingBuffer<T, K>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->takeOver(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the ring from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param ring The ring to fill.
+         * @return The input stream.
+         */
+        friend std::istream& operator>>(std::istream& in, SmallRingBuffer<T, K>& ring) {
+            return details::readSequence<T>(in, ring);
+        }
+
+      private:
+        /**
+         * @brief Returns the inline storage.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the first element of the storage.
+         */
+        inline T* storage() const {
+            return reinterpret_cast<T*>(const_cast<unsigned char*>(this->buffer));
+        }
+
+        /**
+         * @brief Releases the heap storage, if any, the elements must be gone.
+         *
+         * Complexity: O(1)
+         */
+        inline void release() {
+            if (!this->isInline()) {
+                ::operator delete(this->data);
+            }
+        }
+
+        /**
+         * @brief Takes the elements of other into this empty ring, other is left
+         * empty and back on its inline storage.
+         *
+         * Complexity: O(1), if other has spilled to the heap
+         * Complexity: O(m), otherwise
+         *
+         * @param other The ring to take from.
+         */
+        void takeOver(SmallRingBuffer<T, K>& other) {
+            if (other.isInline()) {
+                // m <= K, it fits whatever storage this ring has
+                while (!other.empty()) {
+                    this->constructBack(other.popFront());
+                }
+                other.head = 0;
+                return;
+            }
+
+            this->release();
+            this->data = other.data;
+            this->_capacity = other._capacity;
+            this->head = other.head;
+            this->_len = other._len;
+
+            other.data = other.storage();
+            other._capacity = K;
+            other.head = 0;
+            other._len = 0;
+        }
+
+      private:
+        /**
+         * @brief The inline storage.
+         */
+        alignas(T) unsigned char buffer[sizeof(T) * K];
+    };
+
+} // namespace own
+
+#endif // RING_BUFFER_GUARD_HEADER
@@ -0,0 +1,877 @@
+#ifndef SERIALIZE_GUARD_HEADER
+#define SERIALIZE_GUARD_HEADER
+
+#include "list.hpp"
+
+// std::to_chars and std::from_chars
+#include <charconv>
+// errno and EINTR
+#include <cerrno>
+// std::uint64_t
+#include <cstdint>
+// std::memcpy and std::memmove
+#include <cstring>
+// std::system_error and std::generic_category
+#include <system_error>
+// std::is_trivially_copyable, std::is_integral and std::is_floating_point
+#include <type_traits>
+// ::read and ::write
+#include <unistd.h>
+
+namespace own {
+
+    /**
+     * @brief Default size of the buffer of FdReader and FdWriter.
+     */
+    const usize SERIAL_BUFFER_LEN = 64 * 1024;
+
+    /**
+     * @brief Room needed for a single value in text, the longest output of
+     * std::to_chars for any integer or floating point type fits in it.
+     */
+    const usize SERIAL_TOKEN_LEN = 64;
+
+    /**
+     * @brief Collects the serialized bytes in a growable buffer.
+     *
+     * Every writer provides write(data, len) for raw bytes, plus reserve(len) and
+     * commit(len) to format straight into the buffer, and flush().
+     */
+    class BufferWriter {
+      public:
+        /**
+         * @brief Constructs an empty writer, nothing is allocated until the first
+         * write.
+         *
+         * Complexity: O(1)
+         */
+        BufferWriter() : _data(NULL), _len(0), _capacity(0) {}
+
+        /**
+         * @brief Destructor, the buffer is released.
+         *
+         * Complexity: O(1)
+         */
+        ~BufferWriter() { delete[] this->_data; }
+
+        /**
+         * @brief Returns the bytes written so far.
+         *
+         * Complexity: O(1)
+         */
+        inline const unsigned char* data() const { return this->_data; }
+
+        /**
+         * @brief Returns the amount of bytes written so far.
+         *
+         * Complexity: O(1)
+         */
+        inline usize len() const { return this->_len; }
+
+        /**
+         * @brief Forgets the bytes written so far, the buffer is kept.
+         *
+         * Complexity: O(1)
+         */
+        inline void clear() { this->_len = 0; }
+
+        /**
+         * @brief Appends raw bytes.
+         *
+         * Complexity: O(len), amortized
+         *
+         * @param data The bytes to be written.
+         * @param len The amount of bytes.
+         */
+        inline void write(const void* data, usize len) {
+            std::memcpy(this->reserve(len), data, len);
+            this->_len += len;
+        }
+
+        /**
+         * @brief Returns room for len bytes after the written ones, they only count
+         * once committed.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param len The amount of bytes needed.
+         * @return A pointer to the room.
+         */
+        inline unsigned char* reserve(usize len) {
+            if (this->_capacity - this->_len < len) {
+                this->grow(this->_len + len);
+            }
+
+            return this->_data + this->_len;
+        }
+
+        /**
+         * @brief Counts len bytes of the reserved room as written.
+         *
+         * Complexity: O(1)
+         */
+        inline void commit(usize len) { this->_len += len; }
+
+        /**
+         * @brief Does nothing, the bytes are already in the buffer.
+         *
+         * Complexity: O(1)
+         */
+        inline void flush() {}
+
+      private:
+        /**
+         * @brief Grows the buffer to at least capacity bytes.
+         *
+         * Complexity: O(n)
+         */
+        void grow(usize capacity) {
+            capacity = details::nextPowerOfTwo(capacity < 256 ? 256 : capacity);
+
+            unsigned char* data = new unsigned char[capacity];
+            if (this->_len > 0) {
+                std::memcpy(data, this->_data, this->_len);
+            }
+
+            delete[] this->_data;
+            this->_data = data;
+            this->_capacity = capacity;
+        }
+
+        /**
+         * @brief Writers cannot be copied.
+         */
+        BufferWriter(const BufferWriter&) = delete;
+        void operator=(const BufferWriter&) = delete;
+
+      private:
+        unsigned char* _data;
+        usize _len;
+        usize _capacity;
+    };
+
+    /**
+     * @brief Writes the serialized bytes to a file descriptor through a buffer, so
+     * the values don't cost a system call each.
+     */
+    class FdWriter {
+      public:
+        /**
+         * @brief Constructs a writer for an open file descriptor, which is not
+         * closed by the writer.
+         *
+         * Complexity: O(1)
+         *
+         * @param fd The file descriptor.
+         * @param capacity The size of the buffer.
+         */
+        explicit FdWriter(int fd, usize capacity = SERIAL_BUFFER_LEN) : fd(fd), _len(0) {
+            this->_capacity =
+                capacity < 2 * SERIAL_TOKEN_LEN ? 2 * SERIAL_TOKEN_LEN : capacity;
+            this->buffer = new unsigned char[this->_capacity];
+        }
+
+        /**
+         * @brief Destructor, the pending bytes are flushed.
+         *
+         * Complexity: O(n)
+         *
+         * @note Errors are lost at this point, call flush first to get them.
+         */
+        ~FdWriter() {
+            try {
+                this->flush();
+            } catch (...) {
+            }
+
+            delete[] this->buffer;
+        }
+
+        /**
+         * @brief Writes raw bytes, large ones skip the buffer.
+         *
+         * Complexity: O(len)
+         *
+         * @param data The bytes to be written.
+         * @param len The amount of bytes.
+         * @throws std::system_error if the file descriptor cannot be written.
+         */
+        void write(const void* data, usize len) {
+            if (this->_capacity - this->_len < len) {
+                this->flush();
+            }
+
+            if (len >= this->_capacity) {
+                this->writeAll(static_cast<const unsigned char*>(data), len);
+                return;
+            }
+
+            std::memcpy(this->buffer + this->_len, data, len);
+            this->_len += len;
+        }
+
+        /**
+         * @brief Returns room for len bytes in the buffer, they only count once
+         * committed.
+         *
+         * Complexity: O(1), unless the buffer has to be flushed
+         *
+         * @param len The amount of bytes needed, no more than the buffer size.
+         * @return A pointer to the room.
+         * @throws std::system_error if the file descriptor cannot be written.
+         */
+        inline unsigned char* reserve(usize len) {
+            if (this->_capacity - this->_len < len) {
+                this->flush();
+            }
+
+            return this->buffer + this->_len;
+        }
+
+        /**
+         * @brief Counts len bytes of the reserved room as written.
+         *
+         * Complexity: O(1)
+         */
+        inline void commit(usize len) { this->_len += len; }
+
+        /**
+         * @brief Writes the buffered bytes to the file descriptor.
+         *
+         * Complexity: O(n)
+         *
+         * @throws std::system_error if the file descriptor cannot be written.
+         */
+        void flush() {
+            usize len = this->_len;
+            this->_len = 0;
+            this->writeAll(this->buffer, len);
+        }
+
+      private:
+        /**
+         * @brief Writes every byte, retrying short and interrupted writes.
+         *
+         * Complexity: O(len)
+         */
+        void writeAll(const unsigned char* data, usize len) {
+            while (len > 0) {
+                ssize_t written = ::write(this->fd, data, len);
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(),
+                                            "FdWriter::flush");
+                }
+
+                data += written;
+                len -= usize(written);
+            }
+        }
+
+        /**
+         * @brief Writers cannot be copied.
+         */
+        FdWriter(const FdWriter&) = delete;
+        void operator=(const FdWriter&) = delete;
+
+      private:
+        int fd;
+        unsigned char* buffer;
+        usize _len;
+        usize _capacity;
+    };
+
+    /**
+     * @brief Reads serialized bytes from memory.
+     *
+     * Every reader provides read(dest, len) for raw bytes, plus fill(len), peek(),
+     * available() and consume(len) to parse the buffered bytes in place.
+     */
+    class BufferReader {
+      public:
+        /**
+         * @brief Constructs a reader over bytes that must outlive it.
+         *
+         * Complexity: O(1)
+         *
+         * @param data The bytes to be read.
+         * @param len The amount of bytes.
+         */
+        BufferReader(const void* data, usize len) {
+            this->cursor = static_cast<const unsigned char*>(data);
+            this->last = this->cursor + len;
+        }
+
+        /**
+         * @brief Returns the amount of bytes left.
+         *
+         * Complexity: O(1)
+         */
+        inline usize available() const { return usize(this->last - this->cursor); }
+
+        /**
+         * @brief Returns the next byte to be read.
+         *
+         * Complexity: O(1)
+         */
+        inline const unsigned char* peek() const { return this->cursor; }
+
+        /**
+         * @brief Skips len bytes, no more than available.
+         *
+         * Complexity: O(1)
+         */
+        inline void consume(usize len) { this->cursor += len; }
+
+        /**
+         * @brief Checks if at least len bytes are left.
+         *
+         * Complexity: O(1)
+         */
+        inline bool fill(usize len) { return this->available() >= len; }
+
+        /**
+         * @brief Copies the next len bytes.
+         *
+         * Complexity: O(len)
+         *
+         * @param dest Where the bytes are copied to.
+         * @param len The amount of bytes.
+         * @return False if fewer bytes were left, nothing is read then.
+         */
+        inline bool read(void* dest, usize len) {
+            if (this->available() < len) {
+                return false;
+            }
+
+            std::memcpy(dest, this->cursor, len);
+            this->cursor += len;
+            return true;
+        }
+
+      private:
+        const unsigned char* cursor;
+        const unsigned char* last;
+    };
+
+    /**
+     * @brief Reads serialized bytes from a file descriptor through a buffer.
+     */
+    class FdReader {
+      public:
+        /**
+         * @brief Constructs a reader for an open file descriptor, which is not
+         * closed by the reader.
+         *
+         * Complexity: O(1)
+         *
+         * @param fd The file descriptor.
+         * @param capacity The size of the buffer.
+         */
+        explicit FdReader(int fd, usize capacity = SERIAL_BUFFER_LEN)
+            : fd(fd), eof(false) {
+            this->_capacity =
+                capacity < 2 * SERIAL_TOKEN_LEN ? 2 * SERIAL_TOKEN_LEN : capacity;
+            this->buffer = new unsigned char[this->_capacity];
+            this->cursor = this->buffer;
+            this->last = this->buffer;
+        }
+
+        /**
+         * @brief Destructor, the buffer is released.
+         *
+         * Complexity: O(1)
+         */
+        ~FdReader() { delete[] this->buffer; }
+
+        /**
+         * @brief Returns the amount of buffered bytes.
+         *
+         * Complexity: O(1)
+         */
+        inline usize available() const { return usize(this->last - this->cursor); }
+
+        /**
+         * @brief Returns the next buffered byte.
+         *
+         * Complexity: O(1)
+         */
+        inline const unsigned char* peek() const { return this->cursor; }
+
+        /**
+         * @brief Skips len buffered bytes, no more than available.
+         *
+         * Complexity: O(1)
+         */
+        inline void consume(usize len) { this->cursor += len; }
+
+        /**
+         * @brief Buffers at least len bytes, unless the file ends first.
+         *
+         * Complexity: O(B), where B is the size of the buffer
+         *
+         * @param len The amount of bytes needed, no more than the buffer size.
+         * @return True if len bytes are available, false if the file ended.
+         * @throws std::system_error if the file descriptor cannot be read.
+         */
+        bool fill(usize len) {
+            if (this->available() >= len) {
+                return true;
+            }
+
+            usize left = this->available();
+            std::memmove(this->buffer, this->cursor, left);
+            this->cursor = this->buffer;
+            this->last = this->buffer + left;
+
+            while (this->available() < len && !this->eof) {
+                usize room = usize(this->buffer + this->_capacity - this->last);
+                usize got = this->readSome(this->last, room);
+
+                this->last += got;
+                this->eof = got == 0;
+            }
+
+            return this->available() >= len;
+        }
+
+        /**
+         * @brief Copies the next len bytes, large ones skip the buffer.
+         *
+         * Complexity: O(len)
+         *
+         * @param dest Where the bytes are copied to.
+         * @param len The amount of bytes.
+         * @return False if the file ended first.
+         * @throws std::system_error if the file descriptor cannot be read.
+         */
+        bool read(void* dest, usize len) {
+            unsigned char* out = static_cast<unsigned char*>(dest);
+
+            if (len < this->_capacity) {
+                if (!this->fill(len)) {
+                    return false;
+                }
+
+                std::memcpy(out, this->cursor, len);
+                this->cursor += len;
+                return true;
+            }
+
+            usize left = this->available();
+            std::memcpy(out, this->cursor, left);
+            this->cursor += left;
+
+            for (usize got = left; got < len;) {
+                usize more = this->readSome(out + got, len - got);
+                if (more == 0) {
+                    this->eof = true;
+                    return false;
+                }
+                got += more;
+            }
+
+            return true;
+        }
+
+      private:
+        /**
+         * @brief Reads up to len bytes, retrying interrupted reads.
+         *
+         * Complexity: O(len)
+         *
+         * @return The amount of bytes read, 0 at the end of the file.
+         */
+        usize readSome(unsigned char* dest, usize len) {
+            for (;;) {
+                ssize_t got = ::read(this->fd, dest, len);
+                if (got >= 0) {
+                    return usize(got);
+                }
+                if (errno != EINTR) {
+                    throw std::system_error(errno, std::generic_category(),
+                                            "FdReader::read");
+                }
+            }
+        }
+
+        /**
+         * @brief Readers cannot be copied.
+         */
+        FdReader(const FdReader&) = delete;
+        void operator=(const FdReader&) = delete;
+
+      private:
+        int fd;
+        bool eof;
+        unsigned char* buffer;
+        usize _capacity;
+        const unsigned char* cursor;
+        unsigned char* last;
+    };
+
+    /**
+     * @brief How a value is written in the binary format.
+     *
+     * Trivially copyable values are copied byte by byte, so the format is only meant
+     * to be read back on the same architecture. Other types can specialize it with
+     * the same two functions.
+     *
+     * @tparam T The type of the value.
+     */
+    template <typename T>
+    struct BinaryCodec {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "BinaryCodec must be specialized for non trivially copyable T");
+
+        template <typename Writer>
+        static inline void write(Writer& out, const T& value) {
+            out.write(&value, sizeof(T));
+        }
+
+        template <typename Reader>
+        static inline bool read(Reader& in, T& value) {
+            return in.read(&value, sizeof(T));
+        }
+    };
+
+    namespace details {
+
+        /**
+         * @brief Checks if T is written in text with std::to_chars, which excludes
+         * bool and the character types as iostreams print them differently.
+         */
+        template <typename T>
+        struct IsCharsConvertible
+            : std::integral_constant<
+                  bool, std::is_floating_point<T>::value ||
+                            (std::is_integral<T>::value &&
+                             !std::is_same<T, bool>::value &&
+                             !std::is_same<T, char>::value &&
+                             !std::is_same<T, wchar_t>::value &&
+#if defined(__cpp_char8_t)
+                             !std::is_same<T, char8_t>::value &&
+#endif
+                             !std::is_same<T, char16_t>::value &&
+                             !std::is_same<T, char32_t>::value)> {};
+
+        /**
+         * @brief Thrown by the generator of readBinary when the input ends early.
+         */
+        struct TruncatedInput {};
+
+        /**
+         * @brief Skips spaces, tabs and line breaks.
+         *
+         * Complexity: O(k), where k is the amount of skipped bytes
+         *
+         * @return False if the input ended.
+         */
+        template <typename Reader>
+        bool skipSpace(Reader& in) {
+            while (in.fill(1)) {
+                unsigned char ch = *in.peek();
+                if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r') {
+                    return true;
+                }
+                in.consume(1);
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Checks if a byte ends a value in the text format.
+         */
+        inline bool isTokenEnd(unsigned char ch) {
+            return ch == ',' || ch == ']' || ch == ' ' || ch == '\t' || ch == '\n' ||
+                   ch == '\r';
+        }
+
+        /**
+         * @brief Buffers the next value of the text format, stopping at the first
+         * delimiter instead of waiting for a fixed amount of bytes, so a pipe whose
+         * writer stays open is never read past the closing `]`.
+         *
+         * Complexity: O(k), where k is the length of the value
+         *
+         * @return The length of the value, capped to SERIAL_TOKEN_LEN.
+         */
+        template <typename Reader>
+        usize fillToken(Reader& in) {
+            usize len = 0;
+            while (len < SERIAL_TOKEN_LEN) {
+                if (len == in.available() && !in.fill(len + 1)) {
+                    break;
+                }
+                if (isTokenEnd(in.peek()[len])) {
+                    break;
+                }
+                len++;
+            }
+
+            return len;
+        }
+
+        /**
+         * @brief Elements reserved up front by readBinary, as the length comes from
+         * the input it is bounded by what the input can actually hold.
+         *
+         * Complexity: O(1)
+         */
+        template <typename T, typename Reader>
+        usize binaryChunk(const Reader& in, std::uint64_t remaining) {
+            const usize least = 1024;
+
+            usize chunk = in.available() / sizeof(T);
+            if (chunk < least) {
+                chunk = least;
+            }
+            if (remaining < chunk) {
+                chunk = usize(remaining);
+            }
+
+            return chunk;
+        }
+
+    } // namespace details
+
+    /**
+     * @brief Bulk serialization of containers.
+     *
+     * The binary format is the length as a 64 bit integer followed by every
+     * element through BinaryCodec. The text format is the one of operator<<,
+     * `[a, b, c]`, written with std::to_chars and parsed in place with
+     * std::from_chars, without iostreams.
+     *
+     * Usage:
+     *
+     *     own::FdWriter out(fd);
+     *     own::serial::writeBinary(out, list);
+     *     out.flush();
+     *
+     *     own::BufferReader in(bytes, len);
+     *     own::serial::readBinary(in, list);
+     */
+    namespace serial {
+
+        /**
+         * @brief Writes the length and the elements of a container.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The writer.
+         * @param container The container, it must provide len(), begin() and end().
+         * @throws Whatever the writer throws.
+         */
+        template <typename Writer, typename Container>
+        void writeBinary(Writer& out, const Container& container) {
+            typedef std::decay_t<decltype(*container.begin())> T;
+
+            std::uint64_t len = container.len();
+            out.write(&len, sizeof(len));
+
+            for (auto it = container.begin(), end = container.end(); it != end; ++it) {
+                BinaryCodec<T>::write(out, *it);
+            }
+        }
+
+        /**
+         * @brief Reads elements written by writeBinary and appends them to a list.
+         *
+         * The nodes are built in chunks through List::generateBack, so a
+         * PoolAllocator gets many of them at once. A chunk never exceeds what the
+         * buffered input can hold, so a corrupt length fails as truncated input
+         * instead of as a huge allocation.
+         *
+         * Complexity: O(m), where m is the amount of elements read
+         *
+         * @param in The reader.
+         * @param list The list the elements are appended to.
+         * @return False if the input ended early, the list is left as it was.
+         * @throws std::bad_alloc if the nodes cannot be allocated.
+         */
+        template <typename Reader, typename T, template <typename> class Allocator>
+        bool readBinary(Reader& in, List<T, Allocator>& list) {
+            std::uint64_t len;
+            if (!in.read(&len, sizeof(len))) {
+                return false;
+            }
+
+            usize before = list.len();
+            try {
+                while (len > 0) {
+                    usize chunk = details::binaryChunk<T>(in, len);
+                    list.generateBack(chunk, [&in]() {
+                        T value;
+                        if (!BinaryCodec<T>::read(in, value)) {
+                            throw details::TruncatedInput();
+                        }
+                        return value;
+                    });
+                    len -= chunk;
+                }
+            } catch (details::TruncatedInput&) {
+                while (list.len() > before) {
+                    list.popBack();
+                }
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Reads elements written by writeBinary and pushes them at the back
+         * of a container.
+         *
+         * Complexity: O(m), where m is the amount of elements read
+         *
+         * @param in The reader.
+         * @param container The container, it must provide pushBack and popBack,
+         * and reserve is called if it has one.
+         * @return False if the input ended early, the container is left as it was.
+         * @throws Whatever pushBack or reserve throws.
+         *
+         * @note The reservation is bounded as in the List overload, the container
+         * grows past it as the elements are read.
+         */
+        template <typename Reader, typename Container>
+        bool readBinary(Reader& in, Container& container) {
+            typedef std::decay_t<decltype(*container.begin())> T;
+
+            std::uint64_t len;
+            if (!in.read(&len, sizeof(len))) {
+                return false;
+            }
+
+            usize before = container.len();
+            if constexpr (details::HasReserve<Container>::value) {
+                container.reserve(before + details::binaryChunk<T>(in, len));
+            }
+
+            for (std::uint64_t i = 0; i < len; i++) {
+                T value;
+                if (!BinaryCodec<T>::read(in, value)) {
+                    while (container.len() > before) {
+                        container.popBack();
+                    }
+                    return false;
+                }
+                container.pushBack(std::move(value));
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Writes a container as `[a, b, c]`.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The writer.
+         * @param container The container of integers or floating points, it must
+         * provide begin() and end().
+         * @throws Whatever the writer throws.
+         *
+         * @note Floating points are written with the shortest representation that
+         * reads back the same value, not with the 6 digits of iostreams.
+         */
+        template <typename Writer, typename Container>
+        void writeText(Writer& out, const Container& container) {
+            typedef std::decay_t<decltype(*container.begin())> T;
+            static_assert(details::IsCharsConvertible<T>::value,
+                          "only integers and floating points are written as text");
+
+            out.write("[", 1);
+
+            bool first = true;
+            for (auto it = container.begin(), end = container.end(); it != end; ++it) {
+                char* room = reinterpret_cast<char*>(out.reserve(SERIAL_TOKEN_LEN + 2));
+                char* cursor = room;
+
+                if (!first) {
+                    *cursor++ = ',';
+                    *cursor++ = ' ';
+                }
+                first = false;
+
+                cursor = std::to_chars(cursor, room + SERIAL_TOKEN_LEN + 2, *it).ptr;
+                out.commit(usize(cursor - room));
+            }
+
+            out.write("]", 1);
+        }
+
+        /**
+         * @brief Reads a sequence written as `[a, b, c]` pushing every value at the
+         * back of the container.
+         *
+         * Complexity: O(m), where m is the amount of bytes read
+         *
+         * @param in The reader.
+         * @param container The container of integers or floating points, it must
+         * provide pushBack, as List::emplaceBack does.
+         * @return False if the input was malformed, the values read before are kept.
+         */
+        template <typename Reader, typename Container>
+        bool readText(Reader& in, Container& container) {
+            typedef std::decay_t<decltype(*container.begin())> T;
+            static_assert(details::IsCharsConvertible<T>::value,
+                          "only integers and floating points are read as text");
+
+            if (!details::skipSpace(in) || *in.peek() != '[') {
+                return false;
+            }
+            in.consume(1);
+
+            if (!details::skipSpace(in)) {
+                return false;
+            }
+            if (*in.peek() == ']') {
+                in.consume(1);
+                return true;
+            }
+
+            for (;;) {
+                if (!details::skipSpace(in)) {
+                    return false;
+                }
+
+                // a token never spans more than SERIAL_TOKEN_LEN bytes
+                usize token = details::fillToken(in);
+                const char* first = reinterpret_cast<const char*>(in.peek());
+                const char* last = first + token;
+
+                T value;
+                std::from_chars_result result = std::from_chars(first, last, value);
+                if (result.ec != std::errc()) {
+                    return false;
+                }
+                in.consume(usize(result.ptr - first));
+
+                container.pushBack(value);
+
+                if (!details::skipSpace(in)) {
+                    return false;
+                }
+
+                unsigned char ch = *in.peek();
+                in.consume(1);
+
+                if (ch == ']') {
+                    return true;
+                }
+                if (ch != ',') {
+                    return false;
+                }
+            }
+        }
+
+    } // namespace serial
+
+} // namespace own
+
+#endif // SERIALIZE_GUARD_HEADER
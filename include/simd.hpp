@@ -0,0 +1,788 @@
+#ifndef SIMD_GUARD_HEADER
+#define SIMD_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::uint8_t, std::uint16_t, std::uint32_t and std::uint64_t
+#include <cstdint>
+// std::memcpy
+#include <cstring>
+// std::is_arithmetic, std::is_enum and std::is_pointer
+#include <type_traits>
+
+// the widest instruction set enabled by the compiler flags (-mavx2, the x86-64
+// baseline, AArch64), OWN_NO_SIMD forces the scalar loops
+#if !defined(OWN_NO_SIMD)
+#if defined(__AVX2__)
+#define OWN_SIMD_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#define OWN_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define OWN_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace own {
+
+    namespace details {
+
+        /**
+         * @brief The type whose lanes compare the same as T, void if T can't be
+         * compared by its bits.
+         *
+         * Integers, enums and pointers are equal only when their bits are, so they
+         * are compared as unsigned integers of the same size. Floating points keep
+         * their own comparison, which knows 0.0 == -0.0 and NaN != NaN.
+         */
+        template <typename T, usize Size = sizeof(T),
+                  bool Bitwise = std::is_integral<T>::value || std::is_enum<T>::value ||
+                                 std::is_pointer<T>::value>
+        struct SimdKey {
+            typedef void type;
+        };
+
+        template <typename T>
+        struct SimdKey<T, 1, true> {
+            typedef std::uint8_t type;
+        };
+
+        template <typename T>
+        struct SimdKey<T, 2, true> {
+            typedef std::uint16_t type;
+        };
+
+        template <typename T>
+        struct SimdKey<T, 4, true> {
+            typedef std::uint32_t type;
+        };
+
+        template <typename T>
+        struct SimdKey<T, 8, true> {
+            typedef std::uint64_t type;
+        };
+
+        template <>
+        struct SimdKey<float, sizeof(float), false> {
+            typedef float type;
+        };
+
+        template <>
+        struct SimdKey<double, sizeof(double), false> {
+            typedef double type;
+        };
+
+        /**
+         * @brief The registers of the enabled instruction set for elements of type
+         * Key, specialized for every key it can compare.
+         *
+         * Every specialization provides:
+         * - Reg, the register type, holding WIDTH elements.
+         * - load(at), reading WIDTH elements from unaligned memory.
+         * - splat(value), filling every lane with value.
+         * - equal(a, b), a mask with BITS bits per byte set where the lanes are
+         *   equal, FULL when all of them are.
+         */
+        template <typename Key>
+        struct SimdLanes {
+            static const bool supported = false;
+        };
+
+#if defined(OWN_SIMD_AVX2)
+        template <typename Key>
+        struct SimdIntLanes {
+            static const bool supported = true;
+            typedef __m256i Reg;
+            static const usize WIDTH = 32 / sizeof(Key);
+            static const usize BITS = 1;
+            static const std::uint64_t FULL = 0xFFFFFFFFu;
+
+            static inline Reg load(const void* at) {
+                return _mm256_loadu_si256(static_cast<const __m256i*>(at));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint8_t> : SimdIntLanes<std::uint8_t> {
+            static inline Reg splat(std::uint8_t value) {
+                return _mm256_set1_epi8(char(value));
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint16_t> : SimdIntLanes<std::uint16_t> {
+            static inline Reg splat(std::uint16_t value) {
+                return _mm256_set1_epi16(short(value));
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint32_t> : SimdIntLanes<std::uint32_t> {
+            static inline Reg splat(std::uint32_t value) {
+                return _mm256_set1_epi32(int(value));
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint64_t> : SimdIntLanes<std::uint64_t> {
+            static inline Reg splat(std::uint64_t value) {
+                return _mm256_set1_epi64x((long long)value);
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi64(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<float> {
+            static const bool supported = true;
+            typedef __m256 Reg;
+            static const usize WIDTH = 8;
+            static const usize BITS = 1;
+            static const std::uint64_t FULL = 0xFFFFFFFFu;
+
+            static inline Reg load(const void* at) {
+                return _mm256_loadu_ps(static_cast<const float*>(at));
+            }
+            static inline Reg splat(float value) { return _mm256_set1_ps(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                __m256i mask = _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+                return std::uint32_t(_mm256_movemask_epi8(mask));
+            }
+        };
+
+        template <>
+        struct SimdLanes<double> {
+            static const bool supported = true;
+            typedef __m256d Reg;
+            static const usize WIDTH = 4;
+            static const usize BITS = 1;
+            static const std::uint64_t FULL = 0xFFFFFFFFu;
+
+            static inline Reg load(const void* at) {
+                return _mm256_loadu_pd(static_cast<const double*>(at));
+            }
+            static inline Reg splat(double value) { return _mm256_set1_pd(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                __m256i mask = _mm256_castpd_si256(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+                return std::uint32_t(_mm256_movemask_epi8(mask));
+            }
+        };
+#elif defined(OWN_SIMD_SSE2)
+        template <typename Key>
+        struct SimdIntLanes {
+            static const bool supported = true;
+            typedef __m128i Reg;
+            static const usize WIDTH = 16 / sizeof(Key);
+            static const usize BITS = 1;
+            static const std::uint64_t FULL = 0xFFFFu;
+
+            static inline Reg load(const void* at) {
+                return _mm_loadu_si128(static_cast<const __m128i*>(at));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint8_t> : SimdIntLanes<std::uint8_t> {
+            static inline Reg splat(std::uint8_t value) {
+                return _mm_set1_epi8(char(value));
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint16_t> : SimdIntLanes<std::uint16_t> {
+            static inline Reg splat(std::uint16_t value) {
+                return _mm_set1_epi16(short(value));
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi16(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint32_t> : SimdIntLanes<std::uint32_t> {
+            static inline Reg splat(std::uint32_t value) {
+                return _mm_set1_epi32(int(value));
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint64_t> : SimdIntLanes<std::uint64_t> {
+            static inline Reg splat(std::uint64_t value) {
+                return _mm_set1_epi64x((long long)value);
+            }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                // SSE2 has no 64 bits comparison, both halves have to be equal
+                __m128i halves = _mm_cmpeq_epi32(a, b);
+                __m128i swapped = _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1));
+                return std::uint32_t(_mm_movemask_epi8(_mm_and_si128(halves, swapped)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<float> {
+            static const bool supported = true;
+            typedef __m128 Reg;
+            static const usize WIDTH = 4;
+            static const usize BITS = 1;
+            static const std::uint64_t FULL = 0xFFFFu;
+
+            static inline Reg load(const void* at) {
+                return _mm_loadu_ps(static_cast<const float*>(at));
+            }
+            static inline Reg splat(float value) { return _mm_set1_ps(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                __m128i mask = _mm_castps_si128(_mm_cmpeq_ps(a, b));
+                return std::uint32_t(_mm_movemask_epi8(mask));
+            }
+        };
+
+        template <>
+        struct SimdLanes<double> {
+            static const bool supported = true;
+            typedef __m128d Reg;
+            static const usize WIDTH = 2;
+            static const usize BITS = 1;
+            static const std::uint64_t FULL = 0xFFFFu;
+
+            static inline Reg load(const void* at) {
+                return _mm_loadu_pd(static_cast<const double*>(at));
+            }
+            static inline Reg splat(double value) { return _mm_set1_pd(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                __m128i mask = _mm_castpd_si128(_mm_cmpeq_pd(a, b));
+                return std::uint32_t(_mm_movemask_epi8(mask));
+            }
+        };
+#elif defined(OWN_SIMD_NEON)
+        /**
+         * @brief Narrows a comparison result to 4 bits per byte, NEON has no
+         * movemask.
+         */
+        inline std::uint64_t neonMask(uint8x16_t equal) {
+            uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+            return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+        }
+
+        template <typename Key>
+        struct SimdNeonLanes {
+            static const bool supported = true;
+            static const usize WIDTH = 16 / sizeof(Key);
+            static const usize BITS = 4;
+            static const std::uint64_t FULL = ~std::uint64_t(0);
+        };
+
+        template <>
+        struct SimdLanes<std::uint8_t> : SimdNeonLanes<std::uint8_t> {
+            typedef uint8x16_t Reg;
+
+            static inline Reg load(const void* at) {
+                return vld1q_u8(static_cast<const std::uint8_t*>(at));
+            }
+            static inline Reg splat(std::uint8_t value) { return vdupq_n_u8(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return neonMask(vceqq_u8(a, b));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint16_t> : SimdNeonLanes<std::uint16_t> {
+            typedef uint16x8_t Reg;
+
+            static inline Reg load(const void* at) {
+                return vld1q_u16(static_cast<const std::uint16_t*>(at));
+            }
+            static inline Reg splat(std::uint16_t value) { return vdupq_n_u16(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return neonMask(vreinterpretq_u8_u16(vceqq_u16(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint32_t> : SimdNeonLanes<std::uint32_t> {
+            typedef uint32x4_t Reg;
+
+            static inline Reg load(const void* at) {
+                return vld1q_u32(static_cast<const std::uint32_t*>(at));
+            }
+            static inline Reg splat(std::uint32_t value) { return vdupq_n_u32(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return neonMask(vreinterpretq_u8_u32(vceqq_u32(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<std::uint64_t> : SimdNeonLanes<std::uint64_t> {
+            typedef uint64x2_t Reg;
+
+            static inline Reg load(const void* at) {
+                return vld1q_u64(static_cast<const std::uint64_t*>(at));
+            }
+            static inline Reg splat(std::uint64_t value) { return vdupq_n_u64(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return neonMask(vreinterpretq_u8_u64(vceqq_u64(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<float> : SimdNeonLanes<float> {
+            typedef float32x4_t Reg;
+
+            static inline Reg load(const void* at) {
+                return vld1q_f32(static_cast<const float*>(at));
+            }
+            static inline Reg splat(float value) { return vdupq_n_f32(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return neonMask(vreinterpretq_u8_u32(vceqq_f32(a, b)));
+            }
+        };
+
+        template <>
+        struct SimdLanes<double> : SimdNeonLanes<double> {
+            typedef float64x2_t Reg;
+
+            static inline Reg load(const void* at) {
+                return vld1q_f64(static_cast<const double*>(at));
+            }
+            static inline Reg splat(double value) { return vdupq_n_f64(value); }
+            static inline std::uint64_t equal(Reg a, Reg b) {
+                return neonMask(vreinterpretq_u8_u64(vceqq_f64(a, b)));
+            }
+        };
+#endif
+
+        /**
+         * @brief Checks if the elements of type T are compared with the registers of
+         * the enabled instruction set.
+         */
+        template <typename T, typename Key = typename SimdKey<T>::type>
+        struct IsSimdComparable
+            : std::integral_constant<bool, SimdLanes<Key>::supported> {};
+
+        template <typename T>
+        struct IsSimdComparable<T, void> : std::false_type {};
+
+        /**
+         * @brief The mask bits of a single lane of T.
+         */
+        template <typename T>
+        struct SimdLaneBits {
+            typedef typename SimdKey<T>::type Key;
+            static const usize value = sizeof(Key) * SimdLanes<Key>::BITS;
+        };
+
+        /**
+         * @brief The mask bits of a whole register of T.
+         */
+        template <typename T>
+        struct SimdMaskBits {
+            typedef typename SimdKey<T>::type Key;
+            static const usize value = SimdLanes<Key>::WIDTH * SimdLaneBits<T>::value;
+        };
+
+        /**
+         * @brief Counts the set bits, without a library call when the processor
+         * lacks the instruction.
+         *
+         * Complexity: O(1)
+         */
+        inline usize popCount(std::uint64_t bits) {
+#if defined(__POPCNT__) || defined(__aarch64__)
+            return usize(__builtin_popcountll(bits));
+#else
+            bits = bits - ((bits >> 1) & 0x5555555555555555ull);
+            bits = (bits & 0x3333333333333333ull) + ((bits >> 2) & 0x3333333333333333ull);
+            bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+            return usize((bits * 0x0101010101010101ull) >> 56);
+#endif
+        }
+
+        /**
+         * @brief Returns the bits of value as its key, to be splatted.
+         */
+        template <typename T>
+        inline typename SimdKey<T>::type simdKey(const T& value) {
+            typename SimdKey<T>::type key;
+            std::memcpy(&key, &value, sizeof(key));
+            return key;
+        }
+
+        /**
+         * @brief How many accumulators the reductions keep, enough for a 32 bytes
+         * register of B so the compiler can map them onto one.
+         */
+        template <typename B>
+        struct SimdReduceLanes {
+            static const usize value =
+                std::is_arithmetic<B>::value && sizeof(B) <= 32 ? 32 / sizeof(B) : 1;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief Searching, counting, comparing and reducing of contiguous elements
+     * with the vector registers of the processor.
+     *
+     * The instruction set is chosen at compile time from the compiler flags: AVX2
+     * if enabled (-mavx2, -march=native), else SSE2 on x86-64 and NEON on AArch64.
+     * Integers, enums and pointers of 1, 2, 4 or 8 bytes are compared by their
+     * bits, floats and doubles with their own comparison. Any other T, or a build
+     * with OWN_NO_SIMD defined, takes the same scalar loops with operator==.
+     *
+     * Vector and UnrolledList run their searches and comparisons through these,
+     * other contiguous storage can call them directly.
+     *
+     * Usage:
+     *
+     *     own::Vector<int> ids = load();
+     *     bool banned = own::simd::find(ids.data(), ids.len(), id) != own::NO_POS;
+     */
+    namespace simd {
+
+        /**
+         * @brief Finds the first element equal to value.
+         *
+         * Complexity: O(n / w), where w is the amount of lanes of a register
+         *
+         * @param data The first element.
+         * @param len The amount of elements.
+         * @param value The value to be found.
+         * @return The index of the first occurrence, or NO_POS if not found.
+         */
+        template <typename T>
+        usize find(const T* data, usize len, const T& value) {
+            usize i = 0;
+
+            if constexpr (details::IsSimdComparable<T>::value) {
+                typedef details::SimdLanes<typename details::SimdKey<T>::type> Lanes;
+                const usize bits = details::SimdLaneBits<T>::value;
+
+                typename Lanes::Reg needle = Lanes::splat(details::simdKey(value));
+                for (; i + Lanes::WIDTH <= len; i += Lanes::WIDTH) {
+                    std::uint64_t mask = Lanes::equal(Lanes::load(data + i), needle);
+                    if (mask != 0) {
+                        return i + usize(__builtin_ctzll(mask)) / bits;
+                    }
+                }
+            }
+
+            for (; i < len; i++) {
+                if (data[i] == value) {
+                    return i;
+                }
+            }
+
+            return NO_POS;
+        }
+
+        /**
+         * @brief Finds the last element equal to value.
+         *
+         * Complexity: O(n / w), where w is the amount of lanes of a register
+         *
+         * @param data The first element.
+         * @param len The amount of elements.
+         * @param value The value to be found.
+         * @return The index of the last occurrence, or NO_POS if not found.
+         */
+        template <typename T>
+        usize rfind(const T* data, usize len, const T& value) {
+            usize i = len;
+
+            if constexpr (details::IsSimdComparable<T>::value) {
+                typedef details::SimdLanes<typename details::SimdKey<T>::type> Lanes;
+                const usize bits = details::SimdLaneBits<T>::value;
+
+                typename Lanes::Reg needle = Lanes::splat(details::simdKey(value));
+                for (; i >= Lanes::WIDTH; i -= Lanes::WIDTH) {
+                    usize at = i - Lanes::WIDTH;
+                    std::uint64_t mask = Lanes::equal(Lanes::load(data + at), needle);
+                    if (mask != 0) {
+                        return at + usize(63 - __builtin_clzll(mask)) / bits;
+                    }
+                }
+            }
+
+            for (; i > 0; i--) {
+                if (data[i - 1] == value) {
+                    return i - 1;
+                }
+            }
+
+            return NO_POS;
+        }
+
+        /**
+         * @brief Calls found with the index of every element equal to value, in
+         * order.
+         *
+         * Complexity: O(n / w + m), where m is the amount of matches
+         *
+         * @param data The first element.
+         * @param len The amount of elements.
+         * @param value The value to be found.
+         * @param found The callable taking the index as usize.
+         */
+        template <typename T, typename Found>
+        void findEach(const T* data, usize len, const T& value, Found found) {
+            usize i = 0;
+
+            if constexpr (details::IsSimdComparable<T>::value) {
+                typedef details::SimdLanes<typename details::SimdKey<T>::type> Lanes;
+                const usize bits = details::SimdLaneBits<T>::value;
+                const std::uint64_t lane = (std::uint64_t(1) << bits) - 1;
+
+                typename Lanes::Reg needle = Lanes::splat(details::simdKey(value));
+                for (; i + Lanes::WIDTH <= len; i += Lanes::WIDTH) {
+                    std::uint64_t mask = Lanes::equal(Lanes::load(data + i), needle);
+                    while (mask != 0) {
+                        usize bit = usize(__builtin_ctzll(mask));
+                        found(i + bit / bits);
+                        mask &= ~(lane << bit);
+                    }
+                }
+            }
+
+            for (; i < len; i++) {
+                if (data[i] == value) {
+                    found(i);
+                }
+            }
+        }
+
+        /**
+         * @brief Counts the elements equal to value.
+         *
+         * Complexity: O(n / w), where w is the amount of lanes of a register
+         *
+         * @param data The first element.
+         * @param len The amount of elements.
+         * @param value The value to be counted.
+         * @return How many elements are equal to value.
+         */
+        template <typename T>
+        usize count(const T* data, usize len, const T& value) {
+            usize count = 0;
+            usize i = 0;
+
+            if constexpr (details::IsSimdComparable<T>::value) {
+                typedef details::SimdLanes<typename details::SimdKey<T>::type> Lanes;
+                const usize bits = details::SimdLaneBits<T>::value;
+
+                const usize maskBits = details::SimdMaskBits<T>::value;
+                // the masks of as many registers as fit are counted at once
+                const usize group = 64 / maskBits;
+
+                typename Lanes::Reg needle = Lanes::splat(details::simdKey(value));
+                usize set = 0;
+                for (; i + group * Lanes::WIDTH <= len; i += group * Lanes::WIDTH) {
+                    std::uint64_t mask = 0;
+                    for (usize g = 0; g < group; g++) {
+                        const T* at = data + i + g * Lanes::WIDTH;
+                        mask |= Lanes::equal(Lanes::load(at), needle) << (g * maskBits);
+                    }
+
+                    set += details::popCount(mask);
+                }
+                for (; i + Lanes::WIDTH <= len; i += Lanes::WIDTH) {
+                    set += details::popCount(Lanes::equal(Lanes::load(data + i), needle));
+                }
+
+                count = set / bits;
+            }
+
+            for (; i < len; i++) {
+                if (data[i] == value) {
+                    count++;
+                }
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Checks if two ranges of the same length hold equal elements.
+         *
+         * Complexity: O(n / w), where w is the amount of lanes of a register
+         *
+         * @param a The first element of a range.
+         * @param b The first element of the other range.
+         * @param len The amount of elements of each range.
+         * @return True if every pair of elements is equal, false otherwise.
+         */
+        template <typename T>
+        bool equal(const T* a, const T* b, usize len) {
+            usize i = 0;
+
+            if constexpr (details::IsSimdComparable<T>::value) {
+                typedef details::SimdLanes<typename details::SimdKey<T>::type> Lanes;
+
+                for (; i + Lanes::WIDTH <= len; i += Lanes::WIDTH) {
+                    typename Lanes::Reg left = Lanes::load(a + i);
+                    if (Lanes::equal(left, Lanes::load(b + i)) != Lanes::FULL) {
+                        return false;
+                    }
+                }
+            }
+
+            for (; i < len; i++) {
+                if (!(a[i] == b[i])) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Adds the elements to initial.
+         *
+         * Arithmetic elements are added into independent accumulators that the
+         * compiler keeps in a vector register, so floating points may round
+         * differently than adding them in order.
+         *
+         * Complexity: O(n)
+         *
+         * @param data The first element.
+         * @param len The amount of elements.
+         * @param initial The initial value, it sets the type of the sum.
+         * @return The sum.
+         */
+        template <typename B, typename T>
+        B sum(const T* data, usize len, B initial) {
+            const usize lanes = details::SimdReduceLanes<B>::value;
+            usize i = 0;
+
+            if constexpr (lanes > 1) {
+                if (len >= lanes) {
+                    B acc[lanes] = {};
+                    for (; i + lanes <= len; i += lanes) {
+                        for (usize k = 0; k < lanes; k++) {
+                            acc[k] += B(data[i + k]);
+                        }
+                    }
+
+                    for (usize k = 0; k < lanes; k++) {
+                        initial += acc[k];
+                    }
+                }
+            }
+
+            for (; i < len; i++) {
+                initial += B(data[i]);
+            }
+
+            return initial;
+        }
+
+        /**
+         * @brief Returns the smallest element, with independent accumulators as
+         * sum.
+         *
+         * Complexity: O(n)
+         *
+         * @param data The first element.
+         * @param len The amount of elements, at least 1.
+         * @return A copy of the smallest element, the first one of them unless T is
+         * arithmetic. If there are NaNs, which one is returned is unspecified.
+         */
+        template <typename T>
+        T min(const T* data, usize len) {
+            const usize lanes = details::SimdReduceLanes<T>::value;
+            T best = data[0];
+            usize i = 1;
+
+            if constexpr (lanes > 1) {
+                if (len >= lanes) {
+                    T acc[lanes];
+                    for (usize k = 0; k < lanes; k++) {
+                        acc[k] = data[k];
+                    }
+
+                    for (i = lanes; i + lanes <= len; i += lanes) {
+                        for (usize k = 0; k < lanes; k++) {
+                            acc[k] = data[i + k] < acc[k] ? data[i + k] : acc[k];
+                        }
+                    }
+
+                    for (usize k = 0; k < lanes; k++) {
+                        best = acc[k] < best ? acc[k] : best;
+                    }
+                }
+            }
+
+            for (; i < len; i++) {
+                if (data[i] < best) {
+                    best = data[i];
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Returns the greatest element, with independent accumulators as sum.
+         *
+         * Complexity: O(n)
+         *
+         * @param data The first element.
+         * @param len The amount of elements, at least 1.
+         * @return A copy of the greatest element, the first one of them unless T is
+         * arithmetic. If there are NaNs, which one is returned is unspecified.
+         */
+        template <typename T>
+        T max(const T* data, usize len) {
+            const usize lanes = details::SimdReduceLanes<T>::value;
+            T best = data[0];
+            usize i = 1;
+
+            if constexpr (lanes > 1) {
+                if (len >= lanes) {
+                    T acc[lanes];
+                    for (usize k = 0; k < lanes; k++) {
+                        acc[k] = data[k];
+                    }
+
+                    for (i = lanes; i + lanes <= len; i += lanes) {
+                        for (usize k = 0; k < lanes; k++) {
+                            acc[k] = acc[k] < data[i + k] ? data[i + k] : acc[k];
+                        }
+                    }
+
+                    for (usize k = 0; k < lanes; k++) {
+                        best = best < acc[k] ? acc[k] : best;
+                    }
+                }
+            }
+
+            for (; i < len; i++) {
+                if (best < data[i]) {
+                    best = data[i];
+                }
+            }
+
+            return best;
+        }
+
+    } // namespace simd
+
+} // namespace own
+
+#endif // SIMD_GUARD_HEADER
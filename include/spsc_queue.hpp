@@ -0,0 +1,403 @@
+#ifndef SPSC_QUEUE_GUARD_HEADER
+#define SPSC_QUEUE_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::atomic and std::atomic_thread_fence
+#include <atomic>
+// std::move and std::forward
+#include <utility>
+// placement new
+#include <new>
+
+// std::atomic::wait and notify_one need C++20
+static_assert(OWN_CPLUSPLUS > 201703L, "spsc_queue.hpp requires C++20 or later");
+
+namespace own {
+
+    /**
+     * @brief How a SpscQueue waits in push and pop.
+     */
+    enum SpscWait {
+        /**
+         * @brief Busy-poll, for the lowest latency between pinned cores.
+         */
+        SPSC_SPIN,
+        /**
+         * @brief Spin for a while, then sleep on the index until the other side
+         * wakes the thread up.
+         */
+        SPSC_BLOCK
+    };
+
+    /**
+     * @brief Amount of polls before a SPSC_BLOCK queue puts a thread to sleep.
+     */
+    const usize SPSC_SPIN_LIMIT = 1024;
+
+    /**
+     * @brief A bounded wait-free queue for exactly one producer thread and one
+     * consumer thread.
+     *
+     * Each side owns its index and keeps a cached copy of the other side's, both in
+     * its own cache line, so the line of the other side is only read when the cached
+     * copy says the queue looks full (or empty).
+     *
+     * It exposes the same push/pop/empty/len API as Queue, tryPush and tryPop never
+     * wait.
+     *
+     * @tparam T The type of the elements.
+     * @tparam Wait How push and pop wait, SPSC_SPIN or SPSC_BLOCK.
+     */
+    template <typename T, SpscWait Wait = SPSC_SPIN>
+    class SpscQueue {
+      public:
+        /**
+         * @brief Constructs an empty queue.
+         *
+         * Complexity: O(1)
+         *
+         * @param capacity How many elements fit, rounded up to a power of two.
+         */
+        explicit SpscQueue(usize capacity) {
+            capacity = details::nextPowerOfTwo(capacity);
+
+            this->slots = new Slot[capacity];
+            this->mask = capacity - 1;
+
+            this->tail.store(0, std::memory_order_relaxed);
+            this->cachedHead = 0;
+            this->producerWaiting.store(false, std::memory_order_relaxed);
+
+            this->head.store(0, std::memory_order_relaxed);
+            this->cachedTail = 0;
+            this->consumerWaiting.store(false, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Destructor, the remaining elements are destroyed.
+         *
+         * Complexity: O(n)
+         *
+         * @note No thread may be using the queue anymore.
+         */
+        ~SpscQueue() {
+            usize end = this->tail.load(std::memory_order_relaxed);
+            for (usize pos = this->head.load(std::memory_order_relaxed); pos != end;
+                 pos++) {
+                this->slots[pos & this->mask].value()->~T();
+            }
+
+            delete[] this->slots;
+        }
+
+        /**
+         * @brief Returns how many elements fit in the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The capacity of the queue.
+         */
+        inline usize capacity() const { return this->mask + 1; }
+
+        /**
+         * @brief Returns the number of elements in the queue.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the queue, exact for the calling side, a lower bound
+         * (producer) or upper bound (consumer) of what the other side will see.
+         */
+        inline usize len() const {
+            // head first, it can never pass the tail loaded after it
+            usize head = this->head.load(std::memory_order_acquire);
+            return this->tail.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the queue is empty, false otherwise.
+         */
+        inline bool empty() const { return this->len() == 0; }
+
+        /**
+         * @brief Constructs an element in place at the end of the queue, unless it's
+         * full. Only the producer may call it.
+         *
+         * Complexity: O(1), wait-free
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return True if the element was pushed, false if the queue was full.
+         */
+        template <typename... Args>
+        bool tryEmplace(Args&&... args) {
+            usize pos = this->tail.load(std::memory_order_relaxed);
+
+            if (pos - this->cachedHead > this->mask) {
+                this->cachedHead = this->head.load(std::memory_order_acquire);
+                if (pos - this->cachedHead > this->mask) {
+                    return false;
+                }
+            }
+
+            new (this->slots[pos & this->mask].value()) T(std::forward<Args>(args)...);
+            this->tail.store(pos + 1, std::memory_order_release);
+
+            if constexpr (Wait == SPSC_BLOCK) {
+                wake(this->tail, this->consumerWaiting);
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Adds an element to the end of the queue, unless it's full. Only the
+         * producer may call it.
+         *
+         * Complexity: O(1), wait-free
+         *
+         * @param value The value to be added.
+         * @return True if the element was pushed, false if the queue was full.
+         */
+        inline bool tryPush(const T& value) { return this->tryEmplace(value); }
+
+        /**
+         * @brief Moves an element to the end of the queue, unless it's full. Only the
+         * producer may call it.
+         *
+         * Complexity: O(1), wait-free
+         *
+         * @param value The value to be moved, it's untouched if the queue was full.
+         * @return True if the element was pushed, false if the queue was full.
+         */
+        inline bool tryPush(T&& value) { return this->tryEmplace(std::move(value)); }
+
+        /**
+         * @brief Returns the first element of the queue without removing it. Only
+         * the consumer may call it.
+         *
+         * Complexity: O(1), wait-free
+         *
+         * @return A pointer to the first element, NULL if the queue is empty.
+         */
+        T* front() {
+            usize pos = this->head.load(std::memory_order_relaxed);
+
+            if (pos == this->cachedTail) {
+                this->cachedTail = this->tail.load(std::memory_order_acquire);
+                if (pos == this->cachedTail) {
+                    return NULL;
+                }
+            }
+
+            return this->slots[pos & this->mask].value();
+        }
+
+        /**
+         * @brief Removes the first element of the queue, unless it's empty. Only the
+         * consumer may call it.
+         *
+         * Complexity: O(1), wait-free
+         *
+         * @param out Where the value of the element is moved to.
+         * @return True if an element was popped, false if the queue was empty.
+         */
+        bool tryPop(T& out) {
+            T* ptr = this->front();
+            if (ptr == NULL) {
+                return false;
+            }
+
+            out = std::move(*ptr);
+            this->discard(ptr);
+
+            return true;
+        }
+
+        /**
+         * @brief Adds an element to the end of the queue, waiting while it's full.
+         * Only the producer may call it.
+         *
+         * Complexity: O(1), if the queue is not full
+         *
+         * @param value The value to be added.
+         */
+        void push(const T& value) {
+            while (!this->tryEmplace(value)) {
+                this->waitFor(this->head, this->producerWaiting, this->fullHead());
+            }
+        }
+
+        /**
+         * @brief Moves an element to the end of the queue, waiting while it's full.
+         * Only the producer may call it.
+         *
+         * Complexity: O(1), if the queue is not full
+         *
+         * @param value The value to be moved.
+         */
+        void push(T&& value) {
+            while (!this->tryEmplace(std::move(value))) {
+                this->waitFor(this->head, this->producerWaiting, this->fullHead());
+            }
+        }
+
+        /**
+         * @brief Removes and returns the first element of the queue, waiting while
+         * it's empty. Only the consumer may call it.
+         *
+         * Complexity: O(1), if the queue is not empty
+         *
+         * @return The value of the element.
+         */
+        T pop() {
+            T* ptr;
+            while ((ptr = this->front()) == NULL) {
+                this->waitFor(this->tail, this->consumerWaiting,
+                              this->head.load(std::memory_order_relaxed));
+            }
+
+            T value = std::move(*ptr);
+            this->discard(ptr);
+
+            return value;
+        }
+
+      private:
+        /**
+         * @brief Returns the head the producer waits to move while the queue is full.
+         *
+         * Complexity: O(1)
+         */
+        inline usize fullHead() const {
+            return this->tail.load(std::memory_order_relaxed) - this->mask - 1;
+        }
+
+        /**
+         * @brief Storage of one element.
+         */
+        struct Slot {
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            inline T* value() { return reinterpret_cast<T*>(this->storage); }
+        };
+
+        /**
+         * @brief Destroys the first element, which has been moved out, and hands its
+         * slot back to the producer.
+         *
+         * Complexity: O(1)
+         */
+        inline void discard(T* ptr) {
+            ptr->~T();
+            this->head.store(this->head.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_release);
+
+            if constexpr (Wait == SPSC_BLOCK) {
+                wake(this->head, this->producerWaiting);
+            }
+        }
+
+        /**
+         * @brief Waits until the index of the other side moves from current.
+         *
+         * SPSC_SPIN polls once. SPSC_BLOCK polls up to SPSC_SPIN_LIMIT times and
+         * then sleeps on the index, telling the other side through waiting.
+         *
+         * Complexity: O(1), for SPSC_SPIN
+         *
+         * @param index The index of the other side.
+         * @param waiting The flag the other side checks before waking this one.
+         * @param current The value the index holds while this side can't progress.
+         */
+        static void waitFor(const std::atomic<usize>& index, std::atomic<bool>& waiting,
+                            usize current) {
+            if constexpr (Wait == SPSC_SPIN) {
+                (void)waiting;
+                (void)current;
+                details::cpuRelax();
+            } else {
+                for (usize i = 0; i < SPSC_SPIN_LIMIT; i++) {
+                    if (index.load(std::memory_order_acquire) != current) {
+                        return;
+                    }
+                    details::cpuRelax();
+                }
+
+                waiting.store(true, std::memory_order_relaxed);
+                // pairs with the fence in wake, one of both sides sees the other
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                index.wait(current, std::memory_order_acquire);
+                waiting.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Wakes the other side up if it's sleeping on index.
+         *
+         * Complexity: O(1)
+         *
+         * @param index The index that has just been moved.
+         * @param waiting The flag of the other side.
+         */
+        static inline void wake(std::atomic<usize>& index, std::atomic<bool>& waiting) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed)) {
+                index.notify_one();
+            }
+        }
+
+        /**
+         * @brief Queues cannot be copied.
+         */
+        SpscQueue(const SpscQueue<T, Wait>&) = delete;
+        void operator=(const SpscQueue<T, Wait>&) = delete;
+
+      private:
+        /**
+         * @brief The slots of the ring.
+         */
+        Slot* slots;
+        /**
+         * @brief capacity - 1, positions are mapped to slots with it.
+         */
+        usize mask;
+
+        /**
+         * @brief The next position to be written, owned by the producer.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> tail;
+        /**
+         * @brief The last head seen by the producer.
+         */
+        usize cachedHead;
+
+        /**
+         * @brief The next position to be read, owned by the consumer.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> head;
+        /**
+         * @brief The last tail seen by the consumer.
+         */
+        usize cachedTail;
+
+        /**
+         * @brief Set while the producer sleeps on a full queue.
+         *
+         * Both flags are checked on every push and pop of a SPSC_BLOCK queue but
+         * rarely written, so they get a line of their own.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<bool> producerWaiting;
+        /**
+         * @brief Set while the consumer sleeps on an empty queue.
+         */
+        std::atomic<bool> consumerWaiting;
+    };
+
+} // namespace own
+
+#endif // SPSC_QUEUE_GUARD_HEADER
@@ -2,6 +2,10 @@
 #define STACK_GUARD_HEADER
 
 #include "list.hpp"
+#include "vector.hpp"
+
+// std::move and std::forward
+#include <utility>
 
 namespace own {
 
@@ -9,25 +13,41 @@ namespace own {
      * @brief A class representing a stack.
      *
      * @tparam T The type of the value stored in the stack.
+     * @tparam Container The underlying container, Vector<T> by default so the
+     * elements are stored contiguously, SmallRingBuffer<T, K> keeps the first K of
+     * them inline, List<T> can be used as well, ReversibleList<T> makes
+     * reverse() O(1), MappedList<T> keeps the stack in a file across restarts,
+     * PersistentStack<T> makes copies O(1) snapshots and StaticList<T, N> never
+     * allocates, which makes the stack usable in constant expressions, see
+     * StaticStack.
+     *
+     * Iterating a stack walks from the top to the bottom, its iterators are the
+     * reverse iterators of the container.
+     *
+     * Elements are accessed through whatever the container returns, so
+     * Stack<T*, IntrusiveList<T> > links objects in place and top() returns a
+     * pointer.
      */
-    template <typename T, typename Container = List<T> >
+    template <typename T, typename Container = Vector<T> >
     class Stack {
       public:
         /**
          * @brief Constructs a stack with the given data.
          *
-         * Complexity: O(n)
+         * Complexity: O(n), if the data is copied
+         * Complexity: O(1), if the data is moved and the container can be moved in
+         * O(1)
          *
          * @param data The data to initialize the stack.
          */
-        Stack(Container container) { this->container = container; }
+        constexpr Stack(Container container) : container(std::move(container)) {}
 
         /**
          * @brief Default constructor.
          *
          * Complexity: O(1)
          */
-        Stack() {}
+        constexpr Stack() {}
 
         /**
          * @brief Copy constructor.
@@ -36,7 +56,17 @@ namespace own {
          *
          * @param other The stack to copy from.
          */
-        Stack(const Stack<T>& other) { this->container = other.container; }
+        constexpr Stack(const Stack<T, Container>& other) : container(other.container) {}
+
+        /**
+         * @brief Move constructor, other is left empty.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @param other The stack to move from.
+         */
+        constexpr Stack(Stack<T, Container>&& other)
+            : container(std::move(other.container)) {}
 
         /**
          * @brief Checks if the stack is empty.
@@ -45,7 +75,7 @@ namespace own {
          *
          * @return True if the stack is empty, otherwise false.
          */
-        inline bool empty() const { return this->container.empty(); }
+        constexpr bool empty() const { return this->container.empty(); }
 
         /**
          * @brief Returns the length of the stack.
@@ -54,7 +84,7 @@ namespace own {
          *
          * @return The length of the stack.
          */
-        inline usize len() const { return this->container.len(); }
+        constexpr usize len() const { return this->container.len(); }
 
         /**
          * @brief Returns a reference to the top element of the stack.
@@ -65,7 +95,7 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        const T& top() const { return this->container.back(); }
+        constexpr decltype(auto) top() const { return this->container.back(); }
 
         /**
          * @brief Returns a reference to the top element of the stack.
@@ -76,7 +106,43 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        T& top() { return this->container.back(); }
+        constexpr decltype(auto) top() { return this->container.back(); }
+
+        /**
+         * @brief Returns an iterator to the top element of the stack.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container, equal to end() if the stack is empty.
+         */
+        constexpr auto begin() { return this->container.rbegin(); }
+
+        /**
+         * @brief Returns an iterator to the top element of the stack.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container, equal to end() if the stack is empty.
+         */
+        constexpr auto begin() const { return this->container.rbegin(); }
+
+        /**
+         * @brief Returns an iterator past the bottom element of the stack.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container.
+         */
+        constexpr auto end() { return this->container.rend(); }
+
+        /**
+         * @brief Returns an iterator past the bottom element of the stack.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator of the container.
+         */
+        constexpr auto end() const { return this->container.rend(); }
 
         /**
          * @brief Pushes an element onto the top of the stack.
@@ -85,10 +151,33 @@ namespace own {
          *
          * @param value The value to be pushed onto the stack.
          */
-        void push(T value) { this->container.pushBack(value); }
+        constexpr void push(const T& value) { this->container.pushBack(value); }
+
+        /**
+         * @brief Moves an element onto the top of the stack.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be moved onto the stack.
+         */
+        constexpr void push(T&& value) { this->container.pushBack(std::move(value)); }
 
         /**
-         * @brief Removes and returns the top element from the stack.
+         * @brief Constructs an element in place onto the top of the stack.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        constexpr decltype(auto) emplace(Args&&... args) {
+            return this->container.emplaceBack(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Removes and returns the top element from the stack, the value is
+         * moved out.
          *
          * Complexity: O(1)
          *
@@ -96,7 +185,31 @@ namespace own {
          *
          * @note It's undefined behavior, if queue is empty.
          */
-        T pop() { return this->container.popBack(); }
+        constexpr T pop() { return this->container.popBack(); }
+
+        /**
+         * @brief Removes up to n elements from the top of the stack, moving them to
+         * out from the top down.
+         *
+         * Complexity: O(m), where m is n or the length if it's shorter
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value.
+         */
+        template <typename Output>
+        constexpr Output popN(Output out, usize n) {
+            if constexpr (details::HasPopBackN<Container, Output>::value) {
+                return this->container.popBackN(out, n);
+            } else {
+                for (; n > 0 && !this->container.empty(); n--) {
+                    *out = this->container.popBack();
+                    ++out;
+                }
+
+                return out;
+            }
+        }
 
         /**
          * @brief Appends another stack to the current stack.
@@ -105,24 +218,59 @@ namespace own {
          *
          * @param other The stack to be appended.
          */
-        void append(Stack<T>& other) {
+        constexpr void append(Stack<T, Container>& other) {
             other.reverse();
             this->container.append(other.container);
         }
 
+        /**
+         * @brief Appends an expiring stack to the current stack.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The stack to be appended.
+         */
+        constexpr void append(Stack<T, Container>&& other) { this->append(other); }
+
+        /**
+         * @brief Places another stack on top of the current stack keeping its order,
+         * the top of other becomes the top of this stack. It's the same as append on
+         * a reversed other, without the reversing pass.
+         *
+         * Complexity: O(1), if the container appends in O(1), as a List does
+         *
+         * @param other The stack to be appended, it's left empty.
+         */
+        constexpr void appendReversed(Stack<T, Container>& other) {
+            this->container.append(other.container);
+        }
+
+        /**
+         * @brief Places an expiring stack on top of the current stack keeping its
+         * order, as appendReversed does.
+         *
+         * Complexity: O(1), if the container appends in O(1), as a List does
+         *
+         * @param other The stack to be appended.
+         */
+        constexpr void appendReversed(Stack<T, Container>&& other) {
+            this->appendReversed(other);
+        }
+
         /**
          * @brief Reverses the order of elements in the stack.
          *
          * Complexity: O(n)
+         * Complexity: O(1), if the container is a ReversibleList
          */
-        void reverse() { this->container.reverse(); }
+        constexpr void reverse() { this->container.reverse(); }
 
         /**
          * @brief Clears all elements from the stack.
          *
          * Complexity: O(n)
          */
-        void clear() { this->container.clear(); }
+        constexpr void clear() { this->container.clear(); }
 
         /**
          * @brief Swaps the contents of this stack with another stack.
@@ -131,7 +279,9 @@ namespace own {
          *
          * @param other The stack to swap with.
          */
-        void swap(Stack<T>& other) { this->container.swap(other.container); }
+        constexpr void swap(Stack<T, Container>& other) {
+            this->container.swap(other.container);
+        }
 
         /**
          * @brief Converts the stack into a container.
@@ -140,7 +290,17 @@ namespace own {
          *
          * @return A container containing the elements of the stack.
          */
-        Container intoContainer() const { return this->container; }
+        constexpr Container intoContainer() const& { return this->container; }
+
+        /**
+         * @brief Converts an expiring stack into a container, the elements are
+         * moved.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @return A container containing the elements of the stack.
+         */
+        constexpr Container intoContainer() && { return std::move(this->container); }
 
         /**
          * @brief Concatenates two stacks.
@@ -150,8 +310,22 @@ namespace own {
          * @param other The stack to concatenate with.
          * @return The concatenated stack.
          */
-        Stack<T> operator+(const Stack<T>& other) const {
-            return Stack<T>(this->container + other.container);
+        constexpr Stack<T, Container> operator+(const Stack<T, Container>& other) const& {
+            return Stack<T, Container>(this->container + other.container);
+        }
+
+        /**
+         * @brief Concatenates two expiring stacks, reusing their elements.
+         *
+         * Complexity: O(1), if the container concatenates expiring containers in
+         * O(1), as a List does
+         *
+         * @param other The stack to concatenate with.
+         * @return The concatenated stack.
+         */
+        constexpr Stack<T, Container> operator+(Stack<T, Container>&& other) && {
+            return Stack<T, Container>(std::move(this->container) +
+                                       std::move(other.container));
         }
 
         /**
@@ -162,11 +336,25 @@ namespace own {
          * @param other The stack to append.
          * @return The updated stack.
          */
-        Stack<T>& operator+=(const Stack<T>& other) {
+        constexpr Stack<T, Container>& operator+=(const Stack<T, Container>& other) {
             this->container += other.container;
             return *this;
         }
 
+        /**
+         * @brief Appends an expiring stack to the current stack, reusing its
+         * elements.
+         *
+         * Complexity: O(1), if the container appends in O(1), as a List does
+         *
+         * @param other The stack to append.
+         * @return The updated stack.
+         */
+        constexpr Stack<T, Container>& operator+=(Stack<T, Container>&& other) {
+            this->container.append(other.container);
+            return *this;
+        }
+
         /**
          * @brief Checks if two stacks are equal.
          *
@@ -175,7 +363,7 @@ namespace own {
          * @param other The stack to compare with.
          * @return True if the stacks are equal, otherwise false.
          */
-        bool operator==(const Stack<T>& other) const {
+        constexpr bool operator==(const Stack<T, Container>& other) const {
             return this->container == other.container;
         }
 
@@ -187,7 +375,7 @@ namespace own {
          * @param other The stack to compare with.
          * @return True if the stacks are not equal, otherwise false.
          */
-        bool operator!=(const Stack<T>& other) const {
+        constexpr bool operator!=(const Stack<T, Container>& other) const {
             return this->container != other.container;
         }
 
@@ -199,7 +387,23 @@ namespace own {
          * @param other The stack to assign from.
          * @return The updated stack.
          */
-        bool operator=(const Stack<T>& other) const { this->container = other.container; }
+        constexpr Stack<T, Container>& operator=(const Stack<T, Container>& other) {
+            this->container = other.container;
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator, other is left empty.
+         *
+         * Complexity: O(1), if the container can be moved in O(1)
+         *
+         * @param other The stack to move from.
+         * @return The updated stack.
+         */
+        constexpr Stack<T, Container>& operator=(Stack<T, Container>&& other) {
+            this->container = std::move(other.container);
+            return *this;
+        }
 
         /**
          * @brief Output stream operator.
@@ -210,7 +414,8 @@ namespace own {
          * @param queue The stack to output.
          * @return The output stream.
          */
-        friend std::ostream& operator<<(std::ostream& out, const Stack<T>& stack) {
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const Stack<T, Container>& stack) {
             return out << stack.container;
         }
 
@@ -223,7 +428,7 @@ namespace own {
          * @param queue The stack to output.
          * @return The input stream.
          */
-        friend std::istream& operator>>(std::istream& in, const Stack<T>& stack) {
+        friend std::istream& operator>>(std::istream& in, Stack<T, Container>& stack) {
             return in >> stack.container;
         }
 
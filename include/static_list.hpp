@@ -0,0 +1,1128 @@
+#ifndef STATIC_LIST_GUARD_HEADER
+#define STATIC_LIST_GUARD_HEADER
+
+#include "core.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+
+// std::uint8_t, std::uint16_t and std::uint32_t
+#include <cstdint>
+// std::initializer_list
+#include <initializer_list>
+// std::ostream and std::istream operator overloading
+#include <iostream>
+// std::bidirectional_iterator_tag and std::reverse_iterator
+#include <iterator>
+// std::construct_at and std::destroy_at
+#include <memory>
+// std::length_error exception
+#include <stdexcept>
+// std::conditional, std::is_convertible and std::is_trivially_destructible
+#include <type_traits>
+// std::move and std::forward
+#include <utility>
+
+// constexpr std::construct_at and requires clauses need C++20
+static_assert(OWN_CPLUSPLUS > 201703L, "static_list.hpp requires C++20 or later");
+
+namespace own {
+
+    namespace details {
+
+        /**
+         * @brief The smallest unsigned integer that indexes N nodes and still has
+         * room for N itself, which marks the lack of a node.
+         */
+        template <usize N>
+        struct StaticIndex {
+            typedef typename std::conditional<
+                N <= 0xFF, std::uint8_t,
+                typename std::conditional<
+                    N <= 0xFFFF, std::uint16_t,
+                    typename std::conditional<N <= 0xFFFFFFFFu, std::uint32_t,
+                                              usize>::type>::type>::type type;
+        };
+
+        /**
+         * @brief A node of a StaticList, linked to its neighbours by their index in
+         * the array of the list.
+         *
+         * The value lives in a union so the array doesn't construct N elements up
+         * front, it's alive only while the node is linked. Free nodes reuse next to
+         * link the free list.
+         */
+        template <typename T, typename Index>
+        struct StaticNode {
+            /**
+             * @brief Constructs a node without a value.
+             *
+             * Complexity: O(1)
+             */
+            constexpr StaticNode() : empty(), back(0), next(0) {}
+
+            /**
+             * @brief The value is destroyed by the list, the node stays trivial when
+             * T is.
+             */
+            constexpr ~StaticNode()
+                requires std::is_trivially_destructible<T>::value
+            = default;
+            constexpr ~StaticNode() {}
+
+            union {
+                /**
+                 * @brief The active member while the node is free.
+                 */
+                char empty;
+                /**
+                 * @brief The value, the active member while the node is linked.
+                 */
+                T value;
+            };
+            /**
+             * @brief Index of the previous node.
+             */
+            Index back;
+            /**
+             * @brief Index of the next node, or of the next free node.
+             */
+            Index next;
+        };
+
+        /**
+         * @brief A bidirectional iterator over a StaticList, past the end is the
+         * missing node so decrementing it reaches the tail.
+         *
+         * @tparam ListT StaticList<T, N> for a mutable iterator, const
+         * StaticList<T, N> otherwise.
+         * @tparam U T for a mutable iterator, const T otherwise.
+         */
+        template <typename ListT, typename U>
+        class StaticIterator {
+          public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef typename std::remove_const<U>::type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef U* pointer;
+            typedef U& reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            constexpr StaticIterator() : list(NULL), at(0) {}
+
+            /**
+             * @brief Constructs an iterator pointing to a node.
+             *
+             * Complexity: O(1)
+             *
+             * @param list The list being iterated.
+             * @param at The index of the node, the capacity for the end of the list.
+             */
+            constexpr StaticIterator(ListT* list, usize at) : list(list), at(at) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename OtherList, typename OtherU>
+                requires std::is_convertible<OtherList*, ListT*>::value &&
+                         std::is_convertible<OtherU*, U*>::value
+            constexpr StaticIterator(const StaticIterator<OtherList, OtherU>& other)
+                : list(other.list), at(other.at) {}
+
+            // Standard bidirectional iterator operations, all of them O(1).
+
+            constexpr reference operator*() const {
+                return this->list->nodes[this->at].value;
+            }
+            constexpr pointer operator->() const { return &**this; }
+
+            constexpr StaticIterator& operator++() {
+                this->at = this->list->nodes[this->at].next;
+                return *this;
+            }
+            constexpr StaticIterator operator++(int) {
+                StaticIterator it = *this;
+                ++*this;
+                return it;
+            }
+            constexpr StaticIterator& operator--() {
+                this->at = this->at == ListT::NONE ? this->list->tail
+                                                   : this->list->nodes[this->at].back;
+                return *this;
+            }
+            constexpr StaticIterator operator--(int) {
+                StaticIterator it = *this;
+                --*this;
+                return it;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend constexpr bool operator==(const StaticIterator& a,
+                                             const StaticIterator& b) {
+                return a.at == b.at;
+            }
+            friend constexpr bool operator!=(const StaticIterator& a,
+                                             const StaticIterator& b) {
+                return a.at != b.at;
+            }
+
+          private:
+            template <typename, typename>
+            friend class StaticIterator;
+
+            /**
+             * @brief The list being iterated.
+             */
+            ListT* list;
+            /**
+             * @brief The index of the current node, the capacity past the end.
+             */
+            usize at;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A double-linked list of at most N elements whose nodes live in an
+     * inline array, linked by index, so it never allocates and can be built and
+     * used in constant expressions.
+     *
+     * Removed nodes are recycled through a free list, and the links take the
+     * smallest integer that indexes N nodes. Pushing into a full list throws
+     * std::length_error, which is a compile error in a constant expression,
+     * tryPushBack and tryPushFront report it instead.
+     *
+     * It provides what Queue and Stack need from their container, StaticQueue and
+     * StaticStack name them:
+     *
+     *     constexpr own::StaticList<int, 4> primes = {2, 3, 5, 7};
+     *     static_assert(primes.back() == 7);
+     *
+     *     constexpr bool balanced(const char* text) {
+     *         own::StaticStack<char, 64> open;
+     *         ...
+     *     }
+     *
+     * @note Moving a list moves the elements one by one, as they are stored inline.
+     *
+     * @tparam T The type of the elements.
+     * @tparam N The capacity of the list.
+     */
+    template <typename T, usize N>
+    class StaticList {
+        static_assert(N > 0, "a static list needs room for at least one element");
+
+        typedef typename details::StaticIndex<N>::type Index;
+        typedef details::StaticNode<T, Index> Node;
+
+      public:
+        typedef details::StaticIterator<StaticList<T, N>, T> iterator;
+        typedef details::StaticIterator<const StaticList<T, N>, const T> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * @brief Constructs an empty list.
+         *
+         * Complexity: O(N), every node is value-initialized, none of them holds an
+         * element
+         */
+        constexpr StaticList() : head(NONE), tail(NONE), free(NONE), used(0), _len(0) {}
+
+        /**
+         * @brief Constructs a list holding a copy of the given values, in order.
+         *
+         * Complexity: O(n)
+         *
+         * @param values The values to be copied.
+         * @throws std::length_error if there are more than N values.
+         */
+        constexpr StaticList(std::initializer_list<T> values) : StaticList() {
+            for (const T& value : values) {
+                this->pushBack(value);
+            }
+        }
+
+        /**
+         * @brief Constructs a list holding a copy of the elements from first to
+         * last, in order.
+         *
+         * Complexity: O(n)
+         *
+         * @param first The first element to be copied.
+         * @param last Past the last element to be copied.
+         * @throws std::length_error if there are more than N elements.
+         */
+        template <typename Iterator,
+                  typename = typename std::iterator_traits<Iterator>::iterator_category>
+        constexpr StaticList(Iterator first, Iterator last) : StaticList() {
+            for (; first != last; ++first) {
+                this->pushBack(*first);
+            }
+        }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to be copied.
+         */
+        constexpr StaticList(const StaticList<T, N>& other) : StaticList() {
+            for (const T& value : other) {
+                this->emplaceBack(value);
+            }
+        }
+
+        /**
+         * @brief Move constructor, the elements of other are moved one by one and
+         * other is left empty.
+         *
+         * Complexity: O(n), as the storage is inline
+         *
+         * @param other The list to be moved.
+         */
+        constexpr StaticList(StaticList<T, N>&& other) : StaticList() {
+            this->append(other);
+        }
+
+        /**
+         * @brief Destructor, trivial if T is trivially destructible.
+         *
+         * Complexity: O(n)
+         */
+        constexpr ~StaticList()
+            requires std::is_trivially_destructible<T>::value
+        = default;
+        constexpr ~StaticList() { this->clear(); }
+
+        /**
+         * @brief Returns the maximum amount of elements.
+         *
+         * Complexity: O(1)
+         */
+        static constexpr usize capacity() { return N; }
+
+        /**
+         * @brief Checks if the list is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        constexpr bool empty() const { return this->_len == 0; }
+
+        /**
+         * @brief Checks if the list holds N elements.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if no more elements fit, false otherwise.
+         */
+        constexpr bool full() const { return this->_len == N; }
+
+        /**
+         * @brief Returns the length of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The amount of elements.
+         */
+        constexpr usize len() const { return this->_len; }
+
+        /**
+         * @brief Returns the first element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A const reference to the first element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr const T& front() const { return this->nodes[this->head].value; }
+
+        /**
+         * @brief Returns the first element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the first element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr T& front() { return this->nodes[this->head].value; }
+
+        /**
+         * @brief Returns the last element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A const reference to the last element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr const T& back() const { return this->nodes[this->tail].value; }
+
+        /**
+         * @brief Returns the last element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the last element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr T& back() { return this->nodes[this->tail].value; }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr iterator begin() { return iterator(this, this->head); }
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr const_iterator begin() const {
+            return const_iterator(this, this->head);
+        }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr iterator end() { return iterator(this, NONE); }
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr const_iterator end() const { return const_iterator(this, NONE); }
+
+        /**
+         * @brief Returns a const iterator to the first element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         */
+        constexpr const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         */
+        constexpr const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a const reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a const reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         */
+        constexpr const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Tries to insert a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return False if the list was full, true otherwise.
+         */
+        constexpr bool tryPushFront(const T& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->link(NONE, this->head, value);
+            return true;
+        }
+
+        /**
+         * @brief Tries to move a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @return False if the list was full, true otherwise.
+         */
+        constexpr bool tryPushFront(T&& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->link(NONE, this->head, std::move(value));
+            return true;
+        }
+
+        /**
+         * @brief Tries to add an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return False if the list was full, true otherwise.
+         */
+        constexpr bool tryPushBack(const T& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->link(this->tail, NONE, value);
+            return true;
+        }
+
+        /**
+         * @brief Tries to move an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @return False if the list was full, true otherwise.
+         */
+        constexpr bool tryPushBack(T&& value) {
+            if (this->full()) {
+                return false;
+            }
+
+            this->link(this->tail, NONE, std::move(value));
+            return true;
+        }
+
+        /**
+         * @brief Inserts a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @throws std::length_error if the list is full.
+         */
+        constexpr void pushFront(const T& value) { this->emplaceFront(value); }
+
+        /**
+         * @brief Moves a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         * @throws std::length_error if the list is full.
+         */
+        constexpr void pushFront(T&& value) { this->emplaceFront(std::move(value)); }
+
+        /**
+         * @brief Adds an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @throws std::length_error if the list is full.
+         */
+        constexpr void pushBack(const T& value) { this->emplaceBack(value); }
+
+        /**
+         * @brief Moves an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         * @throws std::length_error if the list is full.
+         */
+        constexpr void pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::length_error if the list is full.
+         */
+        template <typename... Args>
+        constexpr T& emplaceFront(Args&&... args) {
+            if (this->full()) {
+                throw std::length_error("StaticList::emplaceFront list is full");
+            }
+
+            return this->nodes[this->link(NONE, this->head, std::forward<Args>(args)...)]
+                .value;
+        }
+
+        /**
+         * @brief Constructs a new element in place at the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::length_error if the list is full.
+         */
+        template <typename... Args>
+        constexpr T& emplaceBack(Args&&... args) {
+            if (this->full()) {
+                throw std::length_error("StaticList::emplaceBack list is full");
+            }
+
+            return this->nodes[this->link(this->tail, NONE, std::forward<Args>(args)...)]
+                .value;
+        }
+
+        /**
+         * @brief Constructs a new element in place at the specified position.
+         *
+         * If the position is greater than the length, the element is added at the
+         * end.
+         *
+         * Complexity: O(min(at, n - at)) to reach the position, the linking is O(1)
+         *
+         * @param at The position of the new element.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::length_error if the list is full.
+         */
+        template <typename... Args>
+        constexpr T& emplace(usize at, Args&&... args) {
+            if (this->full()) {
+                throw std::length_error("StaticList::emplace list is full");
+            }
+
+            Index next = at >= this->_len ? NONE : this->indexAt(at);
+            Index back = next == NONE ? this->tail : this->nodes[next].back;
+            return this->nodes[this->link(back, next, std::forward<Args>(args)...)].value;
+        }
+
+        /**
+         * @brief Inserts a copy of value at the specified position, as emplace.
+         *
+         * Complexity: O(min(at, n - at))
+         *
+         * @param at The position of the new element.
+         * @param value The value to be inserted.
+         * @throws std::length_error if the list is full.
+         */
+        constexpr void insert(usize at, const T& value) { this->emplace(at, value); }
+
+        /**
+         * @brief Removes and returns the first element, the value is moved out.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the first element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr T popFront() { return this->take(this->head); }
+
+        /**
+         * @brief Removes and returns the last element, the value is moved out.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the last element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr T popBack() { return this->take(this->tail); }
+
+        /**
+         * @brief Removes and returns the element at the specified position.
+         *
+         * If the position is greater than or equal to the length, the last element
+         * is removed.
+         *
+         * Complexity: O(min(at, n - at)) to reach the position, the unlinking is O(1)
+         *
+         * @param at The position of the element to remove.
+         * @return The removed element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        constexpr T remove(usize at) {
+            return this->take(at >= this->_len ? this->tail : this->indexAt(at));
+        }
+
+        /**
+         * @brief Returns the element at the specified position, walking from the
+         * nearest end.
+         *
+         * Complexity: O(min(at, n - at))
+         *
+         * @param at The position of the element.
+         * @return A const reference to the element.
+         *
+         * @note It's undefined behavior, if at is out of range.
+         */
+        constexpr const T& operator[](usize at) const {
+            return this->nodes[this->indexAt(at)].value;
+        }
+
+        /**
+         * @brief Returns the element at the specified position, walking from the
+         * nearest end.
+         *
+         * Complexity: O(min(at, n - at))
+         *
+         * @param at The position of the element.
+         * @return A reference to the element.
+         *
+         * @note It's undefined behavior, if at is out of range.
+         */
+        constexpr T& operator[](usize at) { return this->nodes[this->indexAt(at)].value; }
+
+        /**
+         * @brief Finds the first occurrence of a specific value in the list.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be found.
+         * @param skip How many elements to ignore.
+         * @return The index of the first occurrence of the value, or NO_POS if not found.
+         */
+        constexpr usize find(const T& value, usize skip = 0) const {
+            usize at = 0;
+            for (Index it = this->head; it != NONE; it = this->nodes[it].next, at++) {
+                if (at >= skip && this->nodes[it].value == value) {
+                    return at;
+                }
+            }
+
+            return NO_POS;
+        }
+
+        /**
+         * @brief Checks if the list contains a specific value.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be checked.
+         * @return True if the list contains the value, false otherwise.
+         */
+        constexpr bool contains(const T& value) const {
+            return this->find(value) != NO_POS;
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this list, other is left
+         * empty.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The list to be appended.
+         * @throws std::length_error if both lists don't fit together, nothing is
+         * moved in that case.
+         */
+        constexpr void append(StaticList<T, N>& other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            if (this->_len + other._len > N) {
+                throw std::length_error("StaticList::append lists don't fit together");
+            }
+
+            while (!other.empty()) {
+                this->link(this->tail, NONE, other.take(other.head));
+            }
+        }
+
+        /**
+         * @brief Moves the elements of an expiring list to the end of this list.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The list to be appended.
+         * @throws std::length_error if both lists don't fit together.
+         */
+        constexpr void append(StaticList<T, N>&& other) { this->append(other); }
+
+        /**
+         * @brief Reverses the list by swapping the links of every node.
+         *
+         * Complexity: O(n)
+         */
+        constexpr void reverse() {
+            for (Index it = this->head; it != NONE;) {
+                Node& node = this->nodes[it];
+                Index next = node.next;
+
+                node.next = node.back;
+                node.back = next;
+                it = next;
+            }
+
+            Index head = this->head;
+            this->head = this->tail;
+            this->tail = head;
+        }
+
+        /**
+         * @brief Removes every element, the nodes become free again.
+         *
+         * Complexity: O(n)
+         */
+        constexpr void clear() {
+            if constexpr (!std::is_trivially_destructible<T>::value) {
+                for (Index it = this->head; it != NONE; it = this->nodes[it].next) {
+                    std::destroy_at(&this->nodes[it].value);
+                }
+            }
+
+            this->head = NONE;
+            this->tail = NONE;
+            this->free = NONE;
+            this->used = 0;
+            this->_len = 0;
+        }
+
+        /**
+         * @brief Swaps the contents of two lists.
+         *
+         * Complexity: O(n + m), as the storage is inline
+         *
+         * @param other The list to swap with.
+         */
+        constexpr void swap(StaticList<T, N>& other) {
+            if (this == &other) {
+                return;
+            }
+
+            StaticList<T, N> moved(std::move(other));
+            other.append(*this);
+            this->append(moved);
+        }
+
+        /**
+         * @brief Concatenates two lists into a new one.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to be concatenated.
+         * @return A new list holding the elements of both lists.
+         * @throws std::length_error if both lists don't fit together.
+         */
+        constexpr StaticList<T, N> operator+(const StaticList<T, N>& other) const {
+            StaticList<T, N> list(*this);
+            list += other;
+            return list;
+        }
+
+        /**
+         * @brief Appends a copy of the elements of other.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The list to be appended.
+         * @return A reference to this list.
+         * @throws std::length_error if both lists don't fit together, nothing is
+         * added in that case.
+         */
+        constexpr StaticList<T, N>& operator+=(const StaticList<T, N>& other) {
+            if (this->_len + other._len > N) {
+                throw std::length_error(
+                    "StaticList::operator+= lists don't fit together");
+            }
+
+            // walking other by length, so appending a list to itself stops
+            usize count = other._len;
+            for (Index it = other.head; count > 0; it = other.nodes[it].next, count--) {
+                this->link(this->tail, NONE, other.nodes[it].value);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Checks if two lists hold the same elements in the same order.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are equal, false otherwise.
+         */
+        constexpr bool operator==(const StaticList<T, N>& other) const {
+            if (this == &other) {
+                return true;
+            }
+            if (this->_len != other._len) {
+                return false;
+            }
+
+            Index otherIt = other.head;
+            for (Index it = this->head; it != NONE; it = this->nodes[it].next) {
+                if (!(this->nodes[it].value == other.nodes[otherIt].value)) {
+                    return false;
+                }
+
+                otherIt = other.nodes[otherIt].next;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Checks if two lists are not equal.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are not equal, false otherwise.
+         */
+        constexpr bool operator!=(const StaticList<T, N>& other) const {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Replaces the elements of this list with a copy of the ones of
+         * other.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to be copied.
+         * @return A reference to this list.
+         */
+        constexpr StaticList<T, N>& operator=(const StaticList<T, N>& other) {
+            if (this != &other) {
+                this->clear();
+                *this += other;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Replaces the elements of this list with the ones of other, which
+         * are moved one by one and other is left empty.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to be moved.
+         * @return A reference to this list.
+         */
+        constexpr StaticList<T, N>& operator=(StaticList<T, N>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->append(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the output stream operator to print the list as a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param list The list to print.
+         * @return The output stream after printing the list.
+         */
+        friend std::ostream& operator<<(std::ostream& out, const StaticList<T, N>& list) {
+            out << '[';
+
+            for (const_iterator it = list.begin(); it != list.end(); ++it) {
+                if (it != list.begin()) {
+                    out << ", ";
+                }
+                out << *it;
+            }
+
+            out << ']';
+            return out;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the list from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param list The list to fill.
+         * @return The input stream.
+         * @throws std::length_error if more than N values are read.
+         */
+        friend std::istream& operator>>(std::istream& in, StaticList<T, N>& list) {
+            return details::readSequence<T>(in, list);
+        }
+
+      private:
+        template <typename, typename>
+        friend class details::StaticIterator;
+
+        /**
+         * @brief The index marking the lack of a node.
+         */
+        static constexpr usize NONE = N;
+
+        /**
+         * @brief Returns the index of the node at a position, walking from the
+         * nearest end.
+         *
+         * Complexity: O(min(at, n - at))
+         */
+        constexpr Index indexAt(usize at) const {
+            Index it;
+            if (at < this->_len / 2) {
+                for (it = this->head; at > 0; at--) {
+                    it = this->nodes[it].next;
+                }
+            } else {
+                it = this->tail;
+                for (usize i = this->_len - 1; i > at; i--) {
+                    it = this->nodes[it].back;
+                }
+            }
+
+            return it;
+        }
+
+        /**
+         * @brief Constructs an element in a free node and links it between back and
+         * next, the node is only taken once the value is constructed.
+         *
+         * Complexity: O(1)
+         *
+         * @return The index of the node.
+         *
+         * @note The list must not be full.
+         */
+        template <typename... Args>
+        constexpr Index link(Index back, Index next, Args&&... args) {
+            Index at = Index(this->free != NONE ? this->free : this->used);
+            Node& node = this->nodes[at];
+            std::construct_at(&node.value, std::forward<Args>(args)...);
+
+            if (at == this->free) {
+                this->free = node.next;
+            } else {
+                this->used++;
+            }
+
+            node.back = back;
+            node.next = next;
+            if (back != NONE) {
+                this->nodes[back].next = at;
+            } else {
+                this->head = at;
+            }
+            if (next != NONE) {
+                this->nodes[next].back = at;
+            } else {
+                this->tail = at;
+            }
+
+            this->_len++;
+            return at;
+        }
+
+        /**
+         * @brief Unlinks a node, moving its value out, and frees it.
+         *
+         * Complexity: O(1)
+         */
+        constexpr T take(Index at) {
+            Node& node = this->nodes[at];
+            T value = std::move(node.value);
+            std::destroy_at(&node.value);
+
+            if (node.back != NONE) {
+                this->nodes[node.back].next = node.next;
+            } else {
+                this->head = node.next;
+            }
+            if (node.next != NONE) {
+                this->nodes[node.next].back = node.back;
+            } else {
+                this->tail = node.back;
+            }
+
+            node.next = this->free;
+            this->free = at;
+            this->_len--;
+            return value;
+        }
+
+        /**
+         * @brief The nodes, linked and free ones alike.
+         */
+        Node nodes[N];
+        /**
+         * @brief Index of the first node, NONE if the list is empty.
+         */
+        Index head;
+        /**
+         * @brief Index of the last node, NONE if the list is empty.
+         */
+        Index tail;
+        /**
+         * @brief Index of the first free node that was used before, NONE if there's
+         * none.
+         */
+        Index free;
+        /**
+         * @brief How many nodes were ever taken, the ones after it were never used.
+         */
+        Index used;
+        /**
+         * @brief The amount of elements.
+         */
+        Index _len;
+    };
+
+    /**
+     * @brief A Queue of at most N elements over a StaticList, it never allocates and
+     * can be used in constant expressions.
+     */
+    template <typename T, usize N>
+    using StaticQueue = Queue<T, StaticList<T, N> >;
+
+    /**
+     * @brief A Stack of at most N elements over a StaticList, it never allocates and
+     * can be used in constant expressions.
+     */
+    template <typename T, usize N>
+    using StaticStack = Stack<T, StaticList<T, N> >;
+
+} // namespace own
+
+#endif // STATIC_LIST_GUARD_HEADER
@@ -0,0 +1,573 @@
+#ifndef THREAD_POOL_GUARD_HEADER
+#define THREAD_POOL_GUARD_HEADER
+
+#include "core.hpp"
+#include "mpmc_queue.hpp"
+#include "work_stealing_deque.hpp"
+
+// std::atomic
+#include <atomic>
+// std::exception_ptr and std::current_exception
+#include <exception>
+// std::next
+#include <iterator>
+// std::mutex and std::lock_guard
+#include <mutex>
+// std::thread
+#include <thread>
+// std::decay
+#include <type_traits>
+// std::forward
+#include <utility>
+
+// std::atomic::wait and notify_all need C++20
+static_assert(OWN_CPLUSPLUS > 201703L, "thread_pool.hpp requires C++20 or later");
+
+namespace own {
+
+    /**
+     * @brief Capacity of the queue tasks submitted from outside a pool go through.
+     */
+    const usize THREAD_POOL_INJECT_CAPACITY = 1024;
+
+    namespace details {
+
+        /**
+         * @brief Tracks a set of tasks, how many are still pending and the first
+         * exception any of them threw.
+         */
+        class TaskGroup {
+          public:
+            /**
+             * @brief Constructs a group without pending tasks.
+             *
+             * Complexity: O(1)
+             */
+            TaskGroup() : pending(0) {}
+
+            /**
+             * @brief Checks if every task of the group has run.
+             *
+             * Complexity: O(1)
+             *
+             * @return True if there are no pending tasks, their effects are then
+             * visible to the calling thread.
+             */
+            inline bool finished() const {
+                return this->pending.load(std::memory_order_acquire) == 0;
+            }
+
+            /**
+             * @brief Adds pending tasks.
+             *
+             * Complexity: O(1)
+             *
+             * @param count The amount of tasks.
+             */
+            inline void add(usize count) {
+                this->pending.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Marks a task as run.
+             *
+             * Complexity: O(1)
+             */
+            inline void done() { this->pending.fetch_sub(1, std::memory_order_release); }
+
+            /**
+             * @brief Records the exception of a task, only the first one is kept.
+             *
+             * Complexity: O(1)
+             *
+             * @param error The exception.
+             */
+            void fail(std::exception_ptr error) {
+                std::lock_guard<std::mutex> guard(this->lock);
+                if (!this->error) {
+                    this->error = error;
+                }
+            }
+
+            /**
+             * @brief Rethrows and forgets the recorded exception, if there is one.
+             *
+             * Complexity: O(1)
+             */
+            void rethrow() {
+                std::exception_ptr error;
+                {
+                    std::lock_guard<std::mutex> guard(this->lock);
+                    error = this->error;
+                    this->error = std::exception_ptr();
+                }
+
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+
+          private:
+            /**
+             * @brief Amount of tasks that have not run yet.
+             */
+            std::atomic<usize> pending;
+            /**
+             * @brief Protects error.
+             */
+            std::mutex lock;
+            /**
+             * @brief The first exception thrown by a task.
+             */
+            std::exception_ptr error;
+        };
+
+        /**
+         * @brief A unit of work of a ThreadPool.
+         */
+        class Task {
+          public:
+            /**
+             * @brief Constructs a task.
+             *
+             * Complexity: O(1)
+             *
+             * @param group The group the task belongs to, NULL if none.
+             */
+            explicit Task(TaskGroup* group) : group(group) {}
+
+            virtual ~Task() {}
+
+            /**
+             * @brief Runs the work of the task.
+             */
+            virtual void run() = 0;
+
+            /**
+             * @brief The group the task belongs to, NULL if none.
+             */
+            TaskGroup* group;
+        };
+
+        /**
+         * @brief A task running a callable.
+         *
+         * @tparam Function The callable type, invoked without arguments.
+         */
+        template <typename Function>
+        class FunctionTask : public Task {
+          public:
+            template <typename F>
+            FunctionTask(F&& function, TaskGroup* group)
+                : Task(group), function(std::forward<F>(function)) {}
+
+            void run() override { this->function(); }
+
+          private:
+            Function function;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A fixed set of worker threads running tasks, balanced by work
+     * stealing.
+     *
+     * Every worker owns a WorkStealingDeque. Tasks submitted from a worker go to
+     * its own deque and are run LIFO, while they are hot in the cache. Tasks
+     * submitted from any other thread go through a shared MpmcQueue. An idle worker
+     * takes from that queue and then steals the oldest task of another worker,
+     * and only sleeps when there is nothing left at all.
+     *
+     * Threads waiting for tasks (wait, forEachSegment) run pending tasks meanwhile,
+     * so they can be used from inside a task too.
+     *
+     * Usage:
+     *
+     *     own::ThreadPool pool;
+     *     own::List<int> list = ...;
+     *
+     *     pool.forEachSegment(list, 0, [](auto first, auto last) {
+     *         for (; first != last; ++first) {
+     *             *first *= 2;
+     *         }
+     *     });
+     */
+    class ThreadPool {
+      public:
+        /**
+         * @brief Starts the worker threads.
+         *
+         * Complexity: O(n)
+         *
+         * @param threads The amount of workers, by default one per hardware thread.
+         * @throws std::system_error if a thread cannot be started, the workers
+         * started before are stopped and joined first.
+         */
+        explicit ThreadPool(usize threads = std::thread::hardware_concurrency())
+            : injected(THREAD_POOL_INJECT_CAPACITY), epoch(0), stopping(false) {
+            this->workerCount = threads > 0 ? threads : 1;
+            this->workers = new Worker[this->workerCount];
+
+            usize started = 0;
+            try {
+                for (; started < this->workerCount; started++) {
+                    this->workers[started].thread =
+                        std::thread(&ThreadPool::work, this, started);
+                }
+            } catch (...) {
+                // joinable threads must not be destroyed, stop the started ones
+                this->stopping.store(true, std::memory_order_release);
+                this->wakeUp();
+
+                for (usize i = 0; i < started; i++) {
+                    this->workers[i].thread.join();
+                }
+                delete[] this->workers;
+                throw;
+            }
+        }
+
+        /**
+         * @brief Runs the remaining tasks and stops the workers, exceptions still
+         * recorded are dropped.
+         *
+         * Complexity: O(n)
+         */
+        ~ThreadPool() {
+            this->helpUntil(this->all);
+
+            this->stopping.store(true, std::memory_order_release);
+            this->wakeUp();
+
+            for (usize i = 0; i < this->workerCount; i++) {
+                this->workers[i].thread.join();
+            }
+            delete[] this->workers;
+        }
+
+        /**
+         * @brief Returns the amount of workers.
+         *
+         * Complexity: O(1)
+         *
+         * @return The amount of worker threads.
+         */
+        inline usize threads() const { return this->workerCount; }
+
+        /**
+         * @brief Schedules a callable to be run by a worker.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param function The callable, invoked without arguments.
+         * @throws std::bad_alloc if the task cannot be allocated.
+         */
+        template <typename Function>
+        void submit(Function&& function) {
+            typedef details::FunctionTask<typename std::decay<Function>::type> TaskT;
+            this->spawn(new TaskT(std::forward<Function>(function), NULL));
+        }
+
+        /**
+         * @brief Waits until every submitted task has run, running tasks meanwhile.
+         *
+         * Complexity: O(n)
+         *
+         * @throws The first exception thrown by a task submitted through submit.
+         */
+        void wait() {
+            this->helpUntil(this->all);
+            this->all.rethrow();
+        }
+
+        /**
+         * @brief Returns how many segments a container is split into.
+         *
+         * Complexity: O(1)
+         *
+         * @param len The length of the container.
+         * @param segments The amount of segments asked for, 0 means 4 per thread.
+         * @return The amount of segments, never more than len.
+         */
+        inline usize segmentCount(usize len, usize segments) const {
+            if (segments == 0) {
+                segments = this->workerCount * 4;
+            }
+            return segments < len ? segments : len;
+        }
+
+        /**
+         * @brief Splits a container into contiguous segments and runs an action on
+         * every one of them in parallel.
+         *
+         * Complexity: O(n / p), where p is the amount of threads
+         *
+         * @param container The container, it must provide len(), begin() and end()
+         * and stay untouched until the call returns.
+         * @param segments The amount of segments, 0 means 4 per thread.
+         * @param action The callable, invoked as action(first, last) with the
+         * iterators of every segment, concurrently from many threads.
+         * @throws The first exception thrown by the action.
+         */
+        template <typename Container, typename Action>
+        void forEachSegment(Container& container, usize segments, Action action) {
+            this->forEachIndexedSegment(
+                container, segments,
+                [&action](auto first, auto last, usize, usize) { action(first, last); });
+        }
+
+        /**
+         * @brief Splits a container into contiguous segments and runs an action on
+         * every one of them in parallel, telling where each segment is.
+         *
+         * The split points are collected with a single walk over the container
+         * (none for random access iterators). The calling thread runs the last
+         * segment itself and helps with the rest until all of them are done.
+         *
+         * Complexity: O(n / p), where p is the amount of threads
+         *
+         * @param container The container, it must provide len(), begin() and end()
+         * and stay untouched until the call returns.
+         * @param segments The amount of segments, 0 means 4 per thread, see
+         * segmentCount.
+         * @param action The callable, invoked as action(first, last, segment, at)
+         * with the iterators of every segment, its number and the index of its first
+         * element, concurrently from many threads.
+         * @throws The first exception thrown by the action.
+         */
+        template <typename Container, typename Action>
+        void forEachIndexedSegment(Container& container, usize segments, Action action) {
+            usize len = container.len();
+            segments = this->segmentCount(len, segments);
+            if (segments == 0) {
+                return;
+            }
+
+            typedef decltype(container.begin()) Iterator;
+
+            details::TaskGroup group;
+            Iterator first = container.begin();
+            usize step = len / segments;
+            usize extra = len % segments;
+            usize at = 0;
+
+            for (usize i = 0; i + 1 < segments; i++) {
+                usize count = step + (i < extra ? 1 : 0);
+                Iterator last = std::next(first, count);
+
+                auto segment = [&action, first, last, i, at]() {
+                    action(first, last, i, at);
+                };
+                typedef details::FunctionTask<decltype(segment)> TaskT;
+
+                group.add(1);
+                try {
+                    this->spawn(new TaskT(segment, &group));
+                } catch (...) {
+                    group.done();
+                    this->helpUntil(group);
+                    throw;
+                }
+
+                first = last;
+                at += count;
+            }
+
+            try {
+                action(first, container.end(), segments - 1, at);
+            } catch (...) {
+                group.fail(std::current_exception());
+            }
+
+            this->helpUntil(group);
+            group.rethrow();
+        }
+
+      private:
+        /**
+         * @brief A worker thread and its tasks, on its own cache lines.
+         */
+        struct alignas(CACHE_LINE_SIZE) Worker {
+            WorkStealingDeque<details::Task*> tasks;
+            std::thread thread;
+        };
+
+        /**
+         * @brief Schedules a task, on the deque of the current worker if it belongs
+         * to this pool, on the shared queue otherwise.
+         *
+         * Complexity: O(1), amortized
+         */
+        void spawn(details::Task* task) {
+            this->all.add(1);
+
+            try {
+                if (ThreadPool::currentPool == this) {
+                    this->workers[ThreadPool::currentWorker].tasks.push(task);
+                } else {
+                    this->injected.push(task);
+                }
+            } catch (...) {
+                this->all.done();
+                delete task;
+                throw;
+            }
+
+            this->wakeUp();
+        }
+
+        /**
+         * @brief Runs one pending task, if any can be found.
+         *
+         * Complexity: O(p), where p is the amount of workers
+         *
+         * @return True if a task was run, false if there was nothing to run.
+         */
+        bool runOne() {
+            details::Task* task = NULL;
+            bool worker = ThreadPool::currentPool == this;
+            usize self = worker ? ThreadPool::currentWorker : 0;
+
+            if (worker && this->workers[self].tasks.pop(task)) {
+                this->execute(task);
+                return true;
+            }
+            if (this->injected.tryPop(task)) {
+                this->execute(task);
+                return true;
+            }
+
+            for (usize i = 1; i <= this->workerCount; i++) {
+                usize victim = (self + i) % this->workerCount;
+                if (worker && victim == self) {
+                    continue;
+                }
+
+                // a steal fails when another thread won the race, retry while the
+                // victim still has tasks
+                WorkStealingDeque<details::Task*>& tasks = this->workers[victim].tasks;
+                while (!tasks.empty()) {
+                    if (tasks.steal(task)) {
+                        this->execute(task);
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Runs a task and marks it as done in its groups.
+         *
+         * Complexity: O(1), plus the task itself
+         */
+        void execute(details::Task* task) {
+            details::TaskGroup* group = task->group;
+
+            try {
+                task->run();
+            } catch (...) {
+                (group ? group : &this->all)->fail(std::current_exception());
+            }
+            delete task;
+
+            if (group) {
+                group->done();
+            }
+            this->all.done();
+        }
+
+        /**
+         * @brief Runs pending tasks until a group is finished.
+         *
+         * Complexity: O(n)
+         */
+        void helpUntil(const details::TaskGroup& group) {
+            while (!group.finished()) {
+                if (!this->runOne()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        /**
+         * @brief Wakes the sleeping workers up, it's cheap when none is sleeping.
+         *
+         * Complexity: O(1)
+         */
+        inline void wakeUp() {
+            this->epoch.fetch_add(1, std::memory_order_release);
+            this->epoch.notify_all();
+        }
+
+        /**
+         * @brief The loop of a worker thread.
+         *
+         * Complexity: O(n)
+         */
+        void work(usize index) {
+            ThreadPool::currentPool = this;
+            ThreadPool::currentWorker = index;
+
+            for (;;) {
+                // read before looking for tasks, so any task spawned later wakes us
+                usize seen = this->epoch.load(std::memory_order_acquire);
+
+                if (this->runOne()) {
+                    continue;
+                }
+                if (this->stopping.load(std::memory_order_acquire)) {
+                    return;
+                }
+
+                this->epoch.wait(seen, std::memory_order_acquire);
+            }
+        }
+
+        /**
+         * @brief Pools cannot be copied.
+         */
+        ThreadPool(const ThreadPool&) = delete;
+        void operator=(const ThreadPool&) = delete;
+
+      private:
+        /**
+         * @brief The pool the current thread works for, NULL if it's no worker.
+         */
+        static inline thread_local ThreadPool* currentPool = NULL;
+        /**
+         * @brief The index of the current worker in its pool.
+         */
+        static inline thread_local usize currentWorker = 0;
+
+        /**
+         * @brief The workers.
+         */
+        Worker* workers;
+        /**
+         * @brief The amount of workers.
+         */
+        usize workerCount;
+        /**
+         * @brief Tasks submitted from outside the pool.
+         */
+        MpmcQueue<details::Task*> injected;
+        /**
+         * @brief Every task of the pool.
+         */
+        details::TaskGroup all;
+        /**
+         * @brief Bumped whenever there may be new tasks, idle workers sleep on it.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> epoch;
+        /**
+         * @brief Set by the destructor.
+         */
+        std::atomic<bool> stopping;
+    };
+
+} // namespace own
+
+#endif // THREAD_POOL_GUARD_HEADER
@@ -0,0 +1,2144 @@
+#ifndef UNROLLED_LIST_GUARD_HEADER
+#define UNROLLED_LIST_GUARD_HEADER
+
+#include "core.hpp"
+#include "simd.hpp"
+
+// std::swap
+#include <algorithm>
+// std::out_of_range exception
+#include <stdexcept>
+// std::move and std::forward
+#include <utility>
+// placement new
+#include <new>
+// std::bidirectional_iterator_tag and std::reverse_iterator
+#include <iterator>
+// std::conditional, std::enable_if and std::is_convertible
+#include <type_traits>
+
+namespace own {
+
+    /**
+     * @brief Default amount of elements stored in every block of an unrolled list.
+     */
+    const usize UNROLLED_BLOCK_LEN = 16;
+
+    namespace details {
+
+        /**
+         * @brief A node of an unrolled linked list, it stores up to N contiguous
+         * elements.
+         *
+         * The elements occupy the slots [first, first + count), so both ends of the
+         * block can grow or shrink without moving the others.
+         *
+         * @tparam T The type of the elements stored in the block.
+         * @tparam N The amount of slots of the block.
+         */
+        template <typename T, usize N>
+        struct Block {
+            /**
+             * @brief Constructs an empty block linked to nothing.
+             *
+             * Complexity: O(1)
+             */
+            Block() : back(NULL), next(NULL), first(0), count(0) {}
+
+            /**
+             * @brief Returns the storage of a slot.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The index of the slot, regardless of first.
+             * @return A pointer to the storage.
+             */
+            inline T* slot(usize at) { return reinterpret_cast<T*>(this->storage) + at; }
+
+            /**
+             * @brief Returns the storage of a slot.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The index of the slot, regardless of first.
+             * @return A pointer to the storage.
+             */
+            inline const T* slot(usize at) const {
+                return reinterpret_cast<const T*>(this->storage) + at;
+            }
+
+            /**
+             * @brief Returns the element at the given position of the block.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position, relative to the first element.
+             * @return A reference to the element.
+             */
+            inline T& value(usize at) { return *this->slot(this->first + at); }
+
+            /**
+             * @brief Returns the element at the given position of the block.
+             *
+             * Complexity: O(1)
+             *
+             * @param at The position, relative to the first element.
+             * @return A reference to the element.
+             */
+            inline const T& value(usize at) const {
+                return *this->slot(this->first + at);
+            }
+
+            /**
+             * @brief Pointer to the previous block.
+             */
+            Block<T, N>* back;
+            /**
+             * @brief Pointer to the next block.
+             */
+            Block<T, N>* next;
+            /**
+             * @brief Slot of the first element.
+             */
+            usize first;
+            /**
+             * @brief The amount of elements.
+             */
+            usize count;
+            /**
+             * @brief The storage of the elements.
+             */
+            alignas(T) unsigned char storage[sizeof(T) * N];
+        };
+
+        /**
+         * @brief Move-constructs an element into a slot and destroys the source.
+         *
+         * Complexity: O(1)
+         *
+         * @param dest The uninitialized slot.
+         * @param src The element to be moved.
+         */
+        template <typename T>
+        inline void relocateOne(T* dest, T* src) {
+            if (dest != src) {
+                new (dest) T(std::move(*src));
+                src->~T();
+            }
+        }
+
+
+        /**
+         * @brief A bidirectional iterator over the elements of an unrolled list.
+         *
+         * Besides the block and the position inside it, it keeps where the list
+         * stores its tail, so the end iterator can be decremented into the last
+         * element.
+         *
+         * @tparam T The type of the elements.
+         * @tparam N The amount of slots of every block.
+         * @tparam BlockT Block<T, N> for a mutable iterator, const Block<T, N>
+         * otherwise.
+         */
+        template <typename T, usize N, typename BlockT>
+        class BlockIterator {
+          public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef typename std::conditional<std::is_const<BlockT>::value, const T*,
+                                              T*>::type pointer;
+            typedef typename std::conditional<std::is_const<BlockT>::value, const T&,
+                                              T&>::type reference;
+
+            /**
+             * @brief Constructs an iterator pointing to nothing.
+             *
+             * Complexity: O(1)
+             */
+            BlockIterator() : _block(NULL), _index(0), tail(NULL) {}
+
+            /**
+             * @brief Constructs an iterator pointing to an element of a block.
+             *
+             * Complexity: O(1)
+             *
+             * @param block The block, NULL for the end of the list.
+             * @param index The position inside the block.
+             * @param tail Where the list stores its tail.
+             */
+            BlockIterator(BlockT* block, usize index, Block<T, N>* const* tail)
+                : _block(block), _index(index), tail(tail) {}
+
+            /**
+             * @brief Converts a mutable iterator into a const one.
+             *
+             * Complexity: O(1)
+             *
+             * @param other The iterator to be converted, only mutable iterators
+             * convert so comparisons between both kinds pick the const one.
+             */
+            template <typename OtherBlock,
+                      typename = typename std::enable_if<
+                          std::is_convertible<OtherBlock*, BlockT*>::value>::type>
+            BlockIterator(const BlockIterator<T, N, OtherBlock>& other)
+                : _block(other.block()), _index(other.index()), tail(other.tailRef()) {}
+
+            /**
+             * @brief Returns the block the iterator points to.
+             *
+             * Complexity: O(1)
+             *
+             * @return The block, NULL if it's the end of the list.
+             */
+            inline BlockT* block() const { return this->_block; }
+
+            /**
+             * @brief Returns the position inside the block.
+             *
+             * Complexity: O(1)
+             *
+             * @return The position, relative to the first element of the block.
+             */
+            inline usize index() const { return this->_index; }
+
+            /**
+             * @brief Returns where the list stores its tail.
+             *
+             * Complexity: O(1)
+             *
+             * @return A pointer to the tail of the list.
+             */
+            inline Block<T, N>* const* tailRef() const { return this->tail; }
+
+            // Standard bidirectional iterator operations, all of them O(1).
+
+            inline reference operator*() const {
+                return this->_block->value(this->_index);
+            }
+            inline pointer operator->() const {
+                return &this->_block->value(this->_index);
+            }
+
+            inline BlockIterator& operator++() {
+                if (++this->_index == this->_block->count) {
+                    this->_block = this->_block->next;
+                    this->_index = 0;
+                }
+                return *this;
+            }
+            inline BlockIterator operator++(int) {
+                BlockIterator it = *this;
+                ++*this;
+                return it;
+            }
+            inline BlockIterator& operator--() {
+                if (this->_block == NULL) {
+                    this->_block = *this->tail;
+                    this->_index = this->_block->count;
+                } else if (this->_index == 0) {
+                    this->_block = this->_block->back;
+                    this->_index = this->_block->count;
+                }
+                this->_index--;
+                return *this;
+            }
+            inline BlockIterator operator--(int) {
+                BlockIterator it = *this;
+                --*this;
+                return it;
+            }
+
+            // Friends, so a mutable iterator converts on either side.
+
+            friend inline bool operator==(const BlockIterator& a,
+                                          const BlockIterator& b) {
+                return a._block == b._block && a._index == b._index;
+            }
+            friend inline bool operator!=(const BlockIterator& a,
+                                          const BlockIterator& b) {
+                return !(a == b);
+            }
+
+          private:
+            /**
+             * @brief The current block.
+             */
+            BlockT* _block;
+            /**
+             * @brief The position inside the current block.
+             */
+            usize _index;
+            /**
+             * @brief Where the list stores its tail.
+             */
+            Block<T, N>* const* tail;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A double-linked list whose nodes store a block of up to BlockLen
+     * elements.
+     *
+     * It keeps the public API of List, but walking the elements touches one node
+     * per block instead of one per element and the per-element overhead of the
+     * links is divided by BlockLen, so iteration throughput and memory footprint are
+     * much better for small T.
+     *
+     * Complexities are written in terms of n elements and B = BlockLen.
+     *
+     * @tparam T The type of elements stored in the list.
+     * @tparam BlockLen The amount of elements stored in every block.
+     */
+    template <typename T, usize BlockLen = UNROLLED_BLOCK_LEN>
+    class UnrolledList {
+        static_assert(BlockLen > 1, "BlockLen must be greater than 1");
+
+        typedef details::Block<T, BlockLen> Block;
+
+      public:
+        /**
+         * @brief Iterators over the elements of this list.
+         */
+        typedef details::BlockIterator<T, BlockLen, Block> iterator;
+        typedef details::BlockIterator<T, BlockLen, const Block> const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Complexity: O(1)
+         */
+        UnrolledList() {
+            this->head = NULL;
+            this->tail = NULL;
+            this->_len = 0;
+        }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to be copied.
+         */
+        UnrolledList(const UnrolledList<T, BlockLen>& other) {
+            this->head = NULL;
+            this->tail = NULL;
+            this->_len = 0;
+
+            *this += other;
+        }
+
+        /**
+         * @brief Move constructor, other is left empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be moved.
+         */
+        UnrolledList(UnrolledList<T, BlockLen>&& other) {
+            this->head = NULL;
+            this->tail = NULL;
+            this->_len = 0;
+
+            this->swap(other);
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Complexity: O(n)
+         */
+        ~UnrolledList() { this->clear(); }
+
+        /**
+         * @brief Checks if the list is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        inline bool empty() const { return this->_len == 0; }
+
+        /**
+         * @brief Returns the length of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the list.
+         */
+        inline usize len() const { return this->_len; }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the front element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& front() const { return this->head->value(0); }
+
+        /**
+         * @brief Get the value of the front element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the front element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T& front() { return this->head->value(0); }
+
+        /**
+         * @brief Get the value of the back element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the back element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline const T& back() const { return this->tail->value(this->tail->count - 1); }
+
+        /**
+         * @brief Get the value of the back element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the back element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        inline T& back() { return this->tail->value(this->tail->count - 1); }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline iterator begin() { return iterator(this->head, 0, &this->tail); }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the list is empty.
+         */
+        inline const_iterator begin() const {
+            return const_iterator(this->head, 0, &this->tail);
+        }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline iterator end() { return iterator(NULL, 0, &this->tail); }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const { return const_iterator(NULL, 0, &this->tail); }
+
+        /**
+         * @brief Returns a const iterator to the first element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to cend() if the list is empty.
+         */
+        inline const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last element, even if the list is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the list is empty.
+         */
+        inline const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(n / B)
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         * @throws std::out_of_range if the specified position is out of range.
+         */
+        const T& at(usize at) const {
+            if (at >= this->_len) {
+                throw std::out_of_range("UnrolledList::at out of range");
+            }
+
+            return (*this)[at];
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(n / B)
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         * @throws std::out_of_range if the specified position is out of range.
+         */
+        T& at(usize at) {
+            if (at >= this->_len) {
+                throw std::out_of_range("UnrolledList::at out of range");
+            }
+
+            return (*this)[at];
+        }
+
+        /**
+         * @brief Insert a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(const T& value) { this->emplaceFront(value); }
+
+        /**
+         * @brief Moves a new element at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value of the new element.
+         */
+        inline void pushFront(T&& value) { this->emplaceFront(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the front of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            Block* block = this->head;
+
+            if (block == NULL || block->first == 0) {
+                block = this->insertBlockAfter(NULL);
+                // further pushes at the front will fill this block backwards
+                block->first = BlockLen;
+            }
+
+            T* ptr;
+            try {
+                ptr = new (block->slot(block->first - 1)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                if (block->count == 0) {
+                    this->eraseBlock(block);
+                }
+                throw;
+            }
+
+            block->first--;
+            block->count++;
+            this->_len++;
+
+            return *ptr;
+        }
+
+        /**
+         * @brief Removes and returns the first element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popFront() {
+            Block* block = this->head;
+
+            T* ptr = block->slot(block->first);
+            T value = std::move(*ptr);
+            ptr->~T();
+
+            block->first++;
+            block->count--;
+            this->_len--;
+
+            if (block->count == 0) {
+                this->eraseBlock(block);
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Adds an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(const T& value) { this->emplaceBack(value); }
+
+        /**
+         * @brief Moves an element to the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the end of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            Block* block = this->tail;
+
+            if (block == NULL || block->first + block->count == BlockLen) {
+                block = this->insertBlockAfter(this->tail);
+            }
+
+            T* ptr;
+            try {
+                ptr = new (block->slot(block->first + block->count))
+                    T(std::forward<Args>(args)...);
+            } catch (...) {
+                if (block->count == 0) {
+                    this->eraseBlock(block);
+                }
+                throw;
+            }
+
+            block->count++;
+            this->_len++;
+
+            return *ptr;
+        }
+
+        /**
+         * @brief Removes and returns the last element of the list.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T popBack() {
+            Block* block = this->tail;
+
+            T* ptr = block->slot(block->first + block->count - 1);
+            T value = std::move(*ptr);
+            ptr->~T();
+
+            block->count--;
+            this->_len--;
+
+            if (block->count == 0) {
+                this->eraseBlock(block);
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Inserts an element after the specified index.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n / B + B), if 0 < at < len
+         *
+         * @param value The value to be inserted.
+         * @param at The index at which the value should be inserted.
+         */
+        inline void insertForward(const T& value, usize at) {
+            this->insertAt(at >= this->_len ? this->_len : at + 1, value);
+        }
+
+        /**
+         * @brief Moves an element after the specified index.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n / B + B), if 0 < at < len
+         *
+         * @param value The value to be inserted.
+         * @param at The index at which the value should be inserted.
+         */
+        inline void insertForward(T&& value, usize at) {
+            this->insertAt(at >= this->_len ? this->_len : at + 1, std::move(value));
+        }
+
+        /**
+         * @brief Inserts an element before the specified index.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n / B + B), if 0 < at < len
+         *
+         * @param value The value to be inserted.
+         * @param at The index at which the value should be inserted.
+         */
+        inline void insertBackward(const T& value, usize at) {
+            this->insertAt(at >= this->_len ? this->_len : at, value);
+        }
+
+        /**
+         * @brief Moves an element before the specified index.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n / B + B), if 0 < at < len
+         *
+         * @param value The value to be inserted.
+         * @param at The index at which the value should be inserted.
+         */
+        inline void insertBackward(T&& value, usize at) {
+            this->insertAt(at >= this->_len ? this->_len : at, std::move(value));
+        }
+
+        /**
+         * @brief Constructs a new element in place so it ends up at the specified
+         * index, as insertBackward does.
+         *
+         * Complexity: O(1), if at = 0 or at >= len
+         * Complexity: O(n / B + B), if 0 < at < len
+         *
+         * @param at The index at which the element should be constructed.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        inline T& emplace(usize at, Args&&... args) {
+            return this->insertAt(at >= this->_len ? this->_len : at,
+                                  std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Checks if the list contains a specific value.
+         *
+         * Complexity: O(n)
+         *
+         * @param value The value to be checked.
+         * @return True if the list contains the value, false otherwise.
+         */
+        bool contains(const T& value) const { return this->find(value) != NO_POS; }
+
+        /**
+         * @brief Checks if a list is contained in this list.
+         *
+         * If the other list is empty, then it's trivially true
+         *
+         * Unless other is tiny, the values of this list are put in a
+         * details::ValueSet first, hashed if std::hash<T> is enabled or sorted if T
+         * has operator<.
+         *
+         * Complexity: O(n + m), if T is hashable
+         * Complexity: O(n log n + m log n), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         *
+         * @param other The list to be checked.
+         * @return True if the list contains all the values, false otherwise.
+         */
+        bool contains(const UnrolledList<T, BlockLen>& other) const {
+            if constexpr (details::ValueSet<T>::supported) {
+                if (other._len >= VALUE_SET_MIN_QUERIES) {
+                    details::ValueSet<T> values(this->begin(), this->end(), this->_len);
+
+                    for (const Block* block = other.head; block; block = block->next) {
+                        for (usize i = 0; i < block->count; i++) {
+                            if (!values.has(block->value(i))) {
+                                return false;
+                            }
+                        }
+                    }
+
+                    return true;
+                }
+            }
+
+            for (const Block* block = other.head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    if (!this->contains(block->value(i))) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Counts the occurrences of a specific value in the list.
+         *
+         * Complexity: O(n / w), see simd::count
+         *
+         * @param value The value to be counted.
+         * @return How many elements are equal to value.
+         */
+        usize count(const T& value) const {
+            usize count = 0;
+
+            for (const Block* block = this->head; block; block = block->next) {
+                count += simd::count(&block->value(0), block->count, value);
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Counts the elements of the list equal to any of the given values.
+         *
+         * Complexity: O(n + m), if T is hashable, see contains(const UnrolledList&)
+         * Complexity: O(n log m + m log m), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         *
+         * @param values The values to be counted.
+         * @return How many elements are equal to one of the values.
+         */
+        usize count(const UnrolledList<T, BlockLen>& values) const {
+            usize count = 0;
+            this->matchAny(values, [&count](usize) { count++; });
+            return count;
+        }
+
+        /**
+         * @brief Finds the first occurrence of a specific value in the list.
+         *
+         * Complexity: O(n / w), see simd::find
+         *
+         * @param value The value to be found.
+         * @param skip How many elements to ignore.
+         * @return The index of the first occurrence of the value, or NO_POS if not found.
+         */
+        usize find(const T& value, usize skip = 0) const {
+            if (skip >= this->_len) {
+                return NO_POS;
+            }
+
+            usize index;
+            const Block* block = this->locate(skip, index);
+            usize at = skip - index;
+
+            for (; block; block = block->next) {
+                usize found =
+                    simd::find(&block->value(index), block->count - index, value);
+                if (found != NO_POS) {
+                    return at + index + found;
+                }
+
+                at += block->count;
+                index = 0;
+            }
+
+            return NO_POS;
+        }
+
+        /**
+         * @brief Finds the last occurrence of a specific value in the list.
+         *
+         * Complexity: O(n / w), see simd::rfind
+         *
+         * @param value The value to be found.
+         * @param skip How many elements to ignore.
+         * @return The index of the last occurrence of the value, or NO_POS if not found.
+         */
+        usize rfind(const T& value, usize skip = 0) const {
+            if (skip >= this->_len) {
+                return NO_POS;
+            }
+
+            usize index;
+            const Block* block = this->locate(this->_len - skip - 1, index);
+            usize at = this->_len - skip - 1 - index;
+
+            while (block) {
+                usize found = simd::rfind(&block->value(0), index + 1, value);
+                if (found != NO_POS) {
+                    return at + found;
+                }
+
+                block = block->back;
+                if (block) {
+                    index = block->count - 1;
+                    at -= block->count;
+                }
+            }
+
+            return NO_POS;
+        }
+
+        /**
+         * @brief Finds all occurrences of a specific value in the list.
+         *
+         * Complexity: O(n / w + m), where m is the amount of matches
+         *
+         * @param value The value to be found.
+         * @return A list of indices where the value is found.
+         */
+        UnrolledList<usize, BlockLen> findAll(const T& value) const {
+            UnrolledList<usize, BlockLen> indices;
+
+            usize at = 0;
+
+            for (const Block* block = this->head; block; block = block->next) {
+                simd::findEach(&block->value(0), block->count, value,
+                               [&indices, at](usize i) { indices.pushBack(at + i); });
+                at += block->count;
+            }
+
+            return indices;
+        }
+
+        /**
+         * @brief Finds all elements of the list equal to any of the given values.
+         *
+         * Complexity: O(n + m), if T is hashable, see contains(const UnrolledList&)
+         * Complexity: O(n log m + m log m), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         *
+         * @param values The values to be found.
+         * @return A list of indices where one of the values is found.
+         */
+        UnrolledList<usize, BlockLen> findAll(
+            const UnrolledList<T, BlockLen>& values) const {
+            UnrolledList<usize, BlockLen> indices;
+            this->matchAny(values, [&indices](usize at) { indices.pushBack(at); });
+            return indices;
+        }
+
+        /**
+         * @brief Removes the element at the specified index.
+         *
+         * If the index is greater than or equal to the length, the last element is
+         * removed.
+         *
+         * Complexity: O(1), if at = 0 or at = len - 1
+         * Complexity: O(n / B + B), if 0 < at < len - 1
+         *
+         * @param at The index of the element to remove.
+         * @return The removed element.
+         *
+         * @note it's undefined behavior if list is empty.
+         */
+        T remove(usize at) {
+            if (at == 0) {
+                return this->popFront();
+            }
+            if (at >= this->_len - 1) {
+                return this->popBack();
+            }
+
+            usize index;
+            Block* block = this->locate(at, index);
+
+            T* ptr = block->slot(block->first + index);
+            T value = std::move(*ptr);
+            ptr->~T();
+
+            // close the gap moving the shortest side
+            if (index < block->count / 2) {
+                for (usize i = index; i > 0; i--) {
+                    details::relocateOne(block->slot(block->first + i),
+                                         block->slot(block->first + i - 1));
+                }
+                block->first++;
+            } else {
+                for (usize i = index + 1; i < block->count; i++) {
+                    details::relocateOne(block->slot(block->first + i - 1),
+                                         block->slot(block->first + i));
+                }
+            }
+
+            block->count--;
+            this->_len--;
+
+            if (block->count == 0) {
+                this->eraseBlock(block);
+            } else if (block->back && this->mergeable(block->back, block)) {
+                this->merge(block->back);
+            } else if (block->next && this->mergeable(block, block->next)) {
+                this->merge(block);
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Retains only the elements in the list that match the given filter
+         * function.
+         *
+         * The remaining elements are compacted into as few blocks as possible.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if
+         * it should be retained, false otherwise.
+         * @return The number of elements that were removed.
+         */
+        template <typename Filter>
+        usize retainIf(Filter filter) {
+            return this->compact([&filter](const T& value) { return !filter(value); });
+        }
+
+        /**
+         * @brief Retains only the elements in the list that match the given filter
+         * function.
+         *
+         * The remaining elements are compacted into as few blocks as possible.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if it
+         * should be retained, false otherwise.
+         * @param ctx The context of filter.
+         * @return The number of elements that were removed.
+         * @tparam Context The context data-type
+         */
+        template <typename Filter, typename Context>
+        usize retainIf(Filter filter, Context& ctx) {
+            return this->compact(
+                [&filter, &ctx](const T& value) { return !filter(value, ctx); });
+        }
+
+        /**
+         * @brief Removes all elements from the list that match the given filter
+         * function.
+         *
+         * The remaining elements are compacted into as few blocks as possible.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if it
+         * should be removed, false otherwise.
+         * @return The number of elements that were removed.
+         */
+        template <typename Filter>
+        usize removeIf(Filter filter) {
+            return this->compact(filter);
+        }
+
+        /**
+         * @brief Removes all elements from the list that match the given filter
+         * function.
+         *
+         * The remaining elements are compacted into as few blocks as possible.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if it
+         * should be removed, false otherwise.
+         * @param ctx The context of filter
+         * @return The number of elements that were removed.
+         * @tparam Context The context data-type
+         */
+        template <typename Filter, typename Context>
+        usize removeIf(Filter filter, Context& ctx) {
+            return this->compact(
+                [&filter, &ctx](const T& value) { return filter(value, ctx); });
+        }
+
+        /**
+         * @brief This function appends the elements in the provided list to the end
+         * of the current list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to be appended.
+         */
+        void append(UnrolledList<T, BlockLen>& other) {
+            if (other.empty() || this == &other) {
+                return;
+            }
+            if (this->_len == 0) {
+                this->swap(other);
+                return;
+            }
+
+            this->_len += other._len;
+
+            this->tail->next = other.head;
+            other.head->back = this->tail;
+
+            this->tail = other.tail;
+
+            other._len = 0;
+            other.head = NULL;
+            other.tail = NULL;
+        }
+
+        /**
+         * @brief This function slices off a portion of the current list and returns
+         * it as a new list.
+         *
+         * The blocks at the boundaries are split, the ones in between are relinked.
+         *
+         * Complexity: O(1), if start = 0 and end = len
+         * Complexity: O(n / B + B), if start > 0 or end < len
+         *
+         * @param start The starting index of the slice.
+         * @param end The ending index of the slice.
+         * @return The sliced portion of the list as a new list.
+         */
+        UnrolledList<T, BlockLen> sliceOff(usize start, usize end) {
+            if (start >= this->_len) {
+                start = this->_len;
+            }
+            if (end > this->_len) {
+                end = this->_len;
+            }
+
+            UnrolledList<T, BlockLen> extractedList;
+
+            if (start >= end) {
+                return extractedList;
+            }
+
+            Block* first = this->splitAt(start);
+            Block* after = this->splitAt(end);
+            Block* last = after ? after->back : this->tail;
+            Block* before = first->back;
+
+            if (before) {
+                before->next = after;
+            } else {
+                this->head = after;
+            }
+            if (after) {
+                after->back = before;
+            } else {
+                this->tail = before;
+            }
+
+            first->back = NULL;
+            last->next = NULL;
+
+            this->_len -= end - start;
+
+            extractedList._len = end - start;
+            extractedList.head = first;
+            extractedList.tail = last;
+
+            return extractedList;
+        }
+
+        /**
+         * @brief This function reverses the order of elements in the current list.
+         *
+         * Complexity: O(n)
+         */
+        void reverse() {
+            Block* block = this->head;
+            while (block) {
+                Block* next = block->next;
+
+                for (usize i = 0, j = block->count - 1; i < j; i++, j--) {
+                    std::swap(block->value(i), block->value(j));
+                }
+                std::swap(block->back, block->next);
+
+                block = next;
+            }
+
+            std::swap(this->head, this->tail);
+        }
+
+        /**
+         * @brief Clears the list by destroying all elements and freeing all blocks.
+         *
+         * Complexity: O(n)
+         */
+        void clear() {
+            Block* block = this->head;
+            while (block) {
+                Block* next = block->next;
+
+                for (usize i = 0; i < block->count; i++) {
+                    block->value(i).~T();
+                }
+                delete block;
+
+                block = next;
+            }
+
+            this->_len = 0;
+            this->head = NULL;
+            this->tail = NULL;
+        }
+
+        /**
+         * @brief Swaps the contents of this list with another list.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The list to swap with.
+         */
+        void swap(UnrolledList<T, BlockLen>& other) {
+            std::swap(this->_len, other._len);
+            std::swap(this->head, other.head);
+            std::swap(this->tail, other.tail);
+        }
+
+        /**
+         * @brief Applies the given action to each element in the list.
+         *
+         * The action takes a const reference to the element.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The function to apply to each element.
+         */
+        template <typename Action>
+        void forEach(Action action) const {
+            for (const Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i));
+                }
+            }
+        }
+
+        /**
+         * @brief Applies the given action to each element in the list.
+         *
+         * The action takes a const reference to the element and the context.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The function to apply to each element.
+         * @param ctx The context of action
+         * @tparam Context the ctx data-type
+         */
+        template <typename Action, typename Context>
+        void forEach(Action action, Context& ctx) const {
+            for (const Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i), ctx);
+                }
+            }
+        }
+
+        /**
+         * @brief Applies the given action to each element in the list.
+         *
+         * The action takes a reference to the element.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The function to apply to each element.
+         */
+        template <typename Action>
+        void forEach(Action action) {
+            for (Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i));
+                }
+            }
+        }
+
+        /**
+         * @brief Applies the given action to each element in the list.
+         *
+         * The action takes a reference to the element and the context.
+         *
+         * Base Complexity: O(n)
+         *
+         * @param action The function to apply to each element.
+         * @param ctx The context of action
+         * @tparam Context the ctx data-type
+         */
+        template <typename Action, typename Context>
+        void forEach(Action action, Context& ctx) {
+            for (Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i), ctx);
+                }
+            }
+        }
+
+        /**
+         * Folds the list by applying an action function to each element.
+         * The action function takes two parameters: const T&, B&.
+         *
+         * @param action   The action function to be applied to each element.
+         * @param initial  The initial value for folding.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) const {
+            for (const Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i), initial);
+                }
+            }
+
+            return initial;
+        }
+
+        /**
+         * Folds the list by applying an action function to each element.
+         * The action function takes three parameters: const T&, B&, Context&.
+         *
+         * @param action   The action function to be applied to each element.
+         * @param initial  The initial value for folding.
+         * @param ctx      The context object passed to the action function.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action, typename Context>
+        B fold(Action action, B initial, Context& ctx) const {
+            for (const Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i), initial, ctx);
+                }
+            }
+
+            return initial;
+        }
+
+        /**
+         * Folds the list by applying an action function to each element.
+         * The action function takes two parameters: T&, B&.
+         *
+         * @param action   The action function to be applied to each element.
+         * @param initial  The initial value for folding.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) {
+            for (Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i), initial);
+                }
+            }
+
+            return initial;
+        }
+
+        /**
+         * Folds the list by applying an action function to each element.
+         * The action function takes three parameters: T&, B&, Context&.
+         *
+         * @param action   The action function to be applied to each element.
+         * @param initial  The initial value for folding.
+         * @param ctx      The context object passed to the action function.
+         *
+         * @return         The final folded value.
+         */
+        template <typename B, typename Action, typename Context>
+        B fold(Action action, B initial, Context& ctx) {
+            for (Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    action(block->value(i), initial, ctx);
+                }
+            }
+
+            return initial;
+        }
+
+        /**
+         * @brief Adds every element to initial a block at a time, see simd::sum.
+         *
+         * Complexity: O(n)
+         *
+         * @param initial The initial value, it sets the type of the sum.
+         * @return The sum.
+         */
+        template <typename B = T>
+        B sum(B initial = B()) const {
+            for (const Block* block = this->head; block; block = block->next) {
+                initial = simd::sum(&block->value(0), block->count, initial);
+            }
+
+            return initial;
+        }
+
+        /**
+         * @brief Returns the smallest element a block at a time, see simd::min.
+         *
+         * Complexity: O(n)
+         *
+         * @return A copy of the smallest element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        T min() const {
+            T best = simd::min(&this->head->value(0), this->head->count);
+            for (const Block* block = this->head->next; block; block = block->next) {
+                T candidate = simd::min(&block->value(0), block->count);
+                if (candidate < best) {
+                    best = candidate;
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Returns the greatest element a block at a time, see simd::max.
+         *
+         * Complexity: O(n)
+         *
+         * @return A copy of the greatest element.
+         *
+         * @note It's undefined behavior, if list is empty.
+         */
+        T max() const {
+            T best = simd::max(&this->head->value(0), this->head->count);
+            for (const Block* block = this->head->next; block; block = block->next) {
+                T candidate = simd::max(&block->value(0), block->count);
+                if (best < candidate) {
+                    best = candidate;
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * Applies a given action on a sliding window of size N over the elements of the
+         * current list. The action is a function pointer that takes an array of size N
+         * and returns a value of type R.
+         *
+         * Every element is written twice into a buffer of 2N, so the window is always
+         * contiguous and nothing has to be shifted.
+         *
+         * @param action The function pointer to be applied on the sliding window.
+         * @return A list containing the results of applying the action on the sliding
+         * window.
+         * @tparam N The size of the sliding window.
+         * @tparam R The return type of the action function.
+         */
+        template <usize N, typename R>
+        UnrolledList<R, BlockLen> window(R (*action)(T[N])) const {
+            T window[2 * N];
+
+            UnrolledList<R, BlockLen> result;
+            usize i = 0;
+
+            for (const Block* block = this->head; block; block = block->next) {
+                for (usize j = 0; j < block->count; j++, i++) {
+                    window[i % N] = block->value(j);
+                    window[i % N + N] = block->value(j);
+
+                    if (i + 1 >= N) {
+                        result.pushBack(action(&window[(i + 1) % N]));
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * Applies a given action on a sliding window of size n over the elements of the
+         * current list. The action is a function pointer that takes an array of size n
+         * and returns a value of type R.
+         *
+         * @param action The function pointer to be applied on the sliding window.
+         * @param n The size of the sliding window.
+         * @return A list containing the results of applying the action on the sliding
+         * window.
+         * @tparam R The return type of the action function.
+         */
+        template <typename R>
+        UnrolledList<R, BlockLen> window(R (*action)(T*, usize n), usize n) const {
+            UnrolledList<R, BlockLen> result;
+
+            if (n == 0) {
+                return result;
+            }
+
+            T* window = new T[2 * n];
+            usize i = 0;
+
+            try {
+                for (const Block* block = this->head; block; block = block->next) {
+                    for (usize j = 0; j < block->count; j++, i++) {
+                        window[i % n] = block->value(j);
+                        window[i % n + n] = block->value(j);
+
+                        if (i + 1 >= n) {
+                            result.pushBack(action(&window[(i + 1) % n], n));
+                        }
+                    }
+                }
+            } catch (...) {
+                delete[] window;
+                throw;
+            }
+
+            delete[] window;
+            return result;
+        }
+
+        /**
+         * @brief Returns a reference to the element at the specified position.
+         *
+         * Complexity: O(n / B)
+         *
+         * @param at The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        const T& operator[](usize at) const {
+            usize index;
+            const Block* block = this->locate(at, index);
+            return block->value(index);
+        }
+
+        /**
+         * @brief Returns a reference to the element at the specified position.
+         *
+         * Complexity: O(n / B)
+         *
+         * @param at The position of the element to access.
+         * @return A reference to the element at the specified position.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        T& operator[](usize at) {
+            usize index;
+            Block* block = this->locate(at, index);
+            return block->value(index);
+        }
+
+        /**
+         * @brief Concatenates this list with another list and returns a new list.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to concatenate with.
+         * @return A new list that contains elements from both lists.
+         */
+        UnrolledList<T, BlockLen>
+        operator+(const UnrolledList<T, BlockLen>& other) const {
+            UnrolledList<T, BlockLen> newList(*this);
+            newList += other;
+            return newList;
+        }
+
+        /**
+         * @brief Appends the elements of another list to this list.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The list to append.
+         * @return A reference to this list after the append operation.
+         */
+        UnrolledList<T, BlockLen>& operator+=(const UnrolledList<T, BlockLen>& other) {
+            // other may be this list, so only its original elements are copied
+            usize remaining = other._len;
+
+            for (const Block* block = other.head; remaining > 0; block = block->next) {
+                for (usize i = 0; i < block->count && remaining > 0; i++, remaining--) {
+                    this->emplaceBack(block->value(i));
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the equality operator to check if two lists are equal.
+         *
+         * Complexity: O(n / w), see simd::equal
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are equal, false otherwise.
+         */
+        bool operator==(const UnrolledList<T, BlockLen>& other) const {
+            if (this == &other) {
+                return true;
+            }
+            if (this->_len != other._len) {
+                return false;
+            }
+
+            // the blocks of both lists may be filled differently, so the longest run
+            // within a block of each of them is compared at once
+            const Block* block = this->head;
+            const Block* otherBlock = other.head;
+            usize i = 0;
+            usize j = 0;
+
+            while (block) {
+                usize left = block->count - i;
+                usize otherLeft = otherBlock->count - j;
+                usize span = left < otherLeft ? left : otherLeft;
+
+                if (!simd::equal(&block->value(i), &otherBlock->value(j), span)) {
+                    return false;
+                }
+
+                i += span;
+                j += span;
+                if (i == block->count) {
+                    block = block->next;
+                    i = 0;
+                }
+                if (j == otherBlock->count) {
+                    otherBlock = otherBlock->next;
+                    j = 0;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Overloads the inequality operator to check if two lists are not
+         * equal.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The list to compare with.
+         * @return True if the lists are not equal, false otherwise.
+         */
+        inline bool operator!=(const UnrolledList<T, BlockLen>& other) const {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Overloads the assignment operator to assign the content of another
+         * list to this list.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The list to assign from.
+         * @return A reference to this list.
+         */
+        UnrolledList<T, BlockLen>& operator=(const UnrolledList<T, BlockLen>& other) {
+            if (this != &other) {
+                this->clear();
+                *this += other;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the move assignment operator to take over the blocks of
+         * another list, which is left empty.
+         *
+         * Complexity: O(n), as the current elements are destroyed
+         *
+         * @param other The list to move from.
+         * @return A reference to this list.
+         */
+        UnrolledList<T, BlockLen>& operator=(UnrolledList<T, BlockLen>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->swap(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the output stream operator to print the list as a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param list The list to print.
+         * @return The output stream after printing the list.
+         */
+        friend std::ostream& operator<<(std::ostream& out,
+                                        const UnrolledList<T, BlockLen>& list) {
+            out << '[';
+
+            bool first = true;
+            for (const Block* block = list.head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++) {
+                    if (!first) {
+                        out << ", ";
+                    }
+                    out << block->value(i);
+                    first = false;
+                }
+            }
+
+            out << ']';
+            return out;
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the list from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param list The list to fill.
+         * @return The input stream.
+         */
+        friend std::istream& operator>>(std::istream& in,
+                                        UnrolledList<T, BlockLen>& list) {
+            return details::readSequence<T>(in, list);
+        }
+
+      private:
+        /**
+         * @brief Returns the block holding the element at the specified index,
+         * walking from the closest end.
+         *
+         * Complexity: O(n / B)
+         *
+         * @param at The index of the element.
+         * @param index Output, the position of the element inside the block.
+         * @return The block holding the element.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        Block* locate(usize at, usize& index) const {
+            Block* block;
+
+            if (at <= this->_len / 2) {
+                block = this->head;
+                while (at >= block->count) {
+                    at -= block->count;
+                    block = block->next;
+                }
+            } else {
+                usize fromBack = this->_len - at - 1;
+                block = this->tail;
+                while (fromBack >= block->count) {
+                    fromBack -= block->count;
+                    block = block->back;
+                }
+                at = block->count - fromBack - 1;
+            }
+
+            index = at;
+            return block;
+        }
+
+        /**
+         * @brief Creates an empty block and links it after the given one.
+         *
+         * Complexity: O(1)
+         *
+         * @param after The block to link after, NULL to link it at the front.
+         * @return The new block.
+         */
+        Block* insertBlockAfter(Block* after) {
+            Block* block = new Block();
+            Block* next = after ? after->next : this->head;
+
+            block->back = after;
+            block->next = next;
+
+            if (after) {
+                after->next = block;
+            } else {
+                this->head = block;
+            }
+            if (next) {
+                next->back = block;
+            } else {
+                this->tail = block;
+            }
+
+            return block;
+        }
+
+        /**
+         * @brief Unlinks and frees a block which holds no elements.
+         *
+         * Complexity: O(1)
+         *
+         * @param block The block to be freed.
+         */
+        void eraseBlock(Block* block) {
+            if (block->back) {
+                block->back->next = block->next;
+            } else {
+                this->head = block->next;
+            }
+            if (block->next) {
+                block->next->back = block->back;
+            } else {
+                this->tail = block->back;
+            }
+
+            delete block;
+        }
+
+        /**
+         * @brief Constructs a new element so it ends up at the specified index.
+         *
+         * A full block is split in halves before inserting into it.
+         *
+         * Complexity: O(1), if at = 0 or at = len
+         * Complexity: O(n / B + B), otherwise
+         *
+         * @param at The index of the new element, up to len.
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& insertAt(usize at, Args&&... args) {
+            if (at == 0) {
+                return this->emplaceFront(std::forward<Args>(args)...);
+            }
+            if (at >= this->_len) {
+                return this->emplaceBack(std::forward<Args>(args)...);
+            }
+
+            // built beforehand, so a throwing constructor leaves no gap behind
+            T value(std::forward<Args>(args)...);
+
+            usize index;
+            Block* block = this->locate(at, index);
+
+            if (block->count == BlockLen) {
+                Block* next = this->splitBlock(block, BlockLen / 2);
+                if (index >= block->count) {
+                    index -= block->count;
+                    block = next;
+                }
+            }
+
+            // open the gap on the side with free slots
+            if (block->first + block->count < BlockLen) {
+                for (usize i = block->count; i > index; i--) {
+                    details::relocateOne(block->slot(block->first + i),
+                                         block->slot(block->first + i - 1));
+                }
+            } else {
+                for (usize i = 0; i < index; i++) {
+                    details::relocateOne(block->slot(block->first + i - 1),
+                                         block->slot(block->first + i));
+                }
+                block->first--;
+            }
+
+            T* ptr = new (block->slot(block->first + index)) T(std::move(value));
+
+            block->count++;
+            this->_len++;
+
+            return *ptr;
+        }
+
+        /**
+         * @brief Moves the elements of a block from the given position onwards into a
+         * new block linked after it.
+         *
+         * Complexity: O(B)
+         *
+         * @param block The block to be split.
+         * @param index The position of the first element to be moved.
+         * @return The new block.
+         */
+        Block* splitBlock(Block* block, usize index) {
+            Block* next = this->insertBlockAfter(block);
+
+            for (usize i = index; i < block->count; i++) {
+                details::relocateOne(next->slot(i - index),
+                                     block->slot(block->first + i));
+            }
+
+            next->count = block->count - index;
+            block->count = index;
+
+            return next;
+        }
+
+        /**
+         * @brief Ensures a block starts at the specified index.
+         *
+         * Complexity: O(n / B + B)
+         *
+         * @param at The index, up to len.
+         * @return The block whose first element is at, NULL if at = len.
+         */
+        Block* splitAt(usize at) {
+            if (at >= this->_len) {
+                return NULL;
+            }
+
+            usize index;
+            Block* block = this->locate(at, index);
+
+            if (index == 0) {
+                return block;
+            }
+
+            return this->splitBlock(block, index);
+        }
+
+        /**
+         * @brief Checks if two neighbour blocks are sparse enough to be merged.
+         *
+         * The threshold is below BlockLen so splitting and merging a block can't
+         * alternate on every insertion and removal.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the blocks should be merged, false otherwise.
+         */
+        inline bool mergeable(const Block* block, const Block* next) const {
+            return block->count + next->count <= BlockLen - BlockLen / 4;
+        }
+
+        /**
+         * @brief Moves every element of the next block into the given block and
+         * frees the next block.
+         *
+         * Complexity: O(B)
+         *
+         * @param block The block that receives the elements.
+         */
+        void merge(Block* block) {
+            Block* next = block->next;
+
+            if (block->first + block->count + next->count > BlockLen) {
+                for (usize i = 0; i < block->count; i++) {
+                    details::relocateOne(block->slot(i), block->slot(block->first + i));
+                }
+                block->first = 0;
+            }
+
+            for (usize i = 0; i < next->count; i++) {
+                details::relocateOne(block->slot(block->first + block->count + i),
+                                     next->slot(next->first + i));
+            }
+
+            block->count += next->count;
+            next->count = 0;
+
+            this->eraseBlock(next);
+        }
+
+        /**
+         * @brief Calls found with the index of every element equal to any of the
+         * given values, indexing the values first unless there are few elements.
+         *
+         * Complexity: O(n + m), if T is hashable
+         * Complexity: O(n log m + m log m), if T is only ordered
+         * Complexity: O(n * m), otherwise
+         */
+        template <typename Found>
+        void matchAny(const UnrolledList<T, BlockLen>& values, Found found) const {
+            if constexpr (details::ValueSet<T>::supported) {
+                if (this->_len >= VALUE_SET_MIN_QUERIES) {
+                    details::ValueSet<T> set(values.begin(), values.end(), values._len);
+
+                    usize at = 0;
+                    for (const Block* block = this->head; block; block = block->next) {
+                        for (usize i = 0; i < block->count; i++, at++) {
+                            if (set.has(block->value(i))) {
+                                found(at);
+                            }
+                        }
+                    }
+
+                    return;
+                }
+            }
+
+            usize at = 0;
+            for (const Block* block = this->head; block; block = block->next) {
+                for (usize i = 0; i < block->count; i++, at++) {
+                    if (values.contains(block->value(i))) {
+                        found(at);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Destroys the elements matching the predicate and packs the rest
+         * into as few blocks as possible.
+         *
+         * Complexity: O(n)
+         *
+         * @param remove A function that returns true if the element must be removed.
+         * @return The number of elements that were removed.
+         */
+        template <typename Predicate>
+        usize compact(Predicate remove) {
+            if (this->_len == 0) {
+                return 0;
+            }
+
+            usize oldLen = this->_len;
+
+            // elements are written in order, never ahead of the one being read
+            Block* dest = this->head;
+            usize written = 0;
+
+            Block* block = this->head;
+            usize i = 0;
+            try {
+                while (block) {
+                    Block* next = block->next;
+                    usize end = block->first + block->count;
+
+                    for (i = block->first; i < end; i++) {
+                        T* ptr = block->slot(i);
+
+                        if (remove(*ptr)) {
+                            ptr->~T();
+                            this->_len--;
+                            continue;
+                        }
+
+                        if (written == BlockLen) {
+                            dest->first = 0;
+                            dest->count = BlockLen;
+                            dest = dest->next;
+                            written = 0;
+                        }
+
+                        details::relocateOne(dest->slot(written), ptr);
+                        written++;
+                    }
+
+                    block = next;
+                }
+            } catch (...) {
+                this->compactUnwound(dest, written, block, i);
+                throw;
+            }
+
+            dest->first = 0;
+            dest->count = written;
+
+            // every block after dest only holds moved-from storage
+            while (dest->next) {
+                dest->next->count = 0;
+                this->eraseBlock(dest->next);
+            }
+            if (dest->count == 0) {
+                this->eraseBlock(dest);
+            }
+
+            return oldLen - this->_len;
+        }
+
+        /**
+         * @brief Restores the blocks after compact was interrupted while reading
+         * the slot at of block, so every slot is either live and counted or gone.
+         *
+         * dest holds written live elements, the blocks between dest and block were
+         * emptied, and block holds its live elements from at on.
+         *
+         * Complexity: O(B + n / B)
+         */
+        void compactUnwound(Block* dest, usize written, Block* block, usize at) {
+            usize end = block->first + block->count;
+
+            if (dest == block) {
+                // what's left of the block follows the written elements
+                for (; at < end; at++) {
+                    details::relocateOne(block->slot(written), block->slot(at));
+                    written++;
+                }
+
+                block->first = 0;
+                block->count = written;
+            } else {
+                block->first = at;
+                block->count = end - at;
+
+                dest->first = 0;
+                dest->count = written;
+
+                while (dest->next != block) {
+                    dest->next->count = 0;
+                    this->eraseBlock(dest->next);
+                }
+                if (dest->count == 0) {
+                    this->eraseBlock(dest);
+                }
+            }
+
+            if (block->count == 0) {
+                this->eraseBlock(block);
+            }
+        }
+
+      private:
+        /**
+         * @brief The length of the list.
+         */
+        usize _len;
+        /**
+         * @brief Pointer to the head block of the list.
+         */
+        Block* head;
+        /**
+         * @brief Pointer to the tail block of the list.
+         */
+        Block* tail;
+    };
+
+} // namespace own
+
+#endif // UNROLLED_LIST_GUARD_HEADER
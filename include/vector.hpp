@@ -0,0 +1,973 @@
+#ifndef VECTOR_GUARD_HEADER
+#define VECTOR_GUARD_HEADER
+
+#include "core.hpp"
+#include "simd.hpp"
+
+// std::swap
+#include <algorithm>
+// std::out_of_range exception
+#include <stdexcept>
+// std::move and std::forward
+#include <utility>
+// placement new
+#include <new>
+// std::reverse_iterator and std::distance
+#include <iterator>
+
+namespace own {
+
+    /**
+     * @brief Capacity of a vector after its first allocation.
+     */
+    const usize VECTOR_MIN_CAPACITY = 8;
+
+    /**
+     * @brief A growable array, elements are stored contiguously and the storage
+     * doubles whenever it's exhausted.
+     *
+     * It provides the same surface as List for the Stack adapter and it's its
+     * default container, pushing and popping at the back never walks nor allocates
+     * per element.
+     *
+     * @tparam T The type of elements stored in the vector.
+     */
+    template <typename T>
+    class Vector {
+      public:
+        /**
+         * @brief Iterators over the elements of this vector, plain pointers.
+         */
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        /**
+         * @brief Default constructor, no storage is allocated until the first push.
+         *
+         * Complexity: O(1)
+         */
+        Vector() {
+            this->_data = NULL;
+            this->_capacity = 0;
+            this->_len = 0;
+        }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The vector to be copied.
+         */
+        Vector(const Vector<T>& other) {
+            this->_data = NULL;
+            this->_capacity = 0;
+            this->_len = 0;
+
+            *this += other;
+        }
+
+        /**
+         * @brief Move constructor, takes over the storage of other which is left
+         * empty.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The vector to be moved.
+         */
+        Vector(Vector<T>&& other) {
+            this->_data = other._data;
+            this->_capacity = other._capacity;
+            this->_len = other._len;
+
+            other._data = NULL;
+            other._capacity = 0;
+            other._len = 0;
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Complexity: O(n)
+         */
+        ~Vector() {
+            this->clear();
+            ::operator delete(this->_data);
+        }
+
+        /**
+         * @brief Checks if the vector is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the vector is empty, false otherwise.
+         */
+        inline bool empty() const { return this->_len == 0; }
+
+        /**
+         * @brief Returns the length of the vector.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the vector.
+         */
+        inline usize len() const { return this->_len; }
+
+        /**
+         * @brief Returns how many elements fit before the storage has to grow.
+         *
+         * Complexity: O(1)
+         *
+         * @return The capacity of the vector.
+         */
+        inline usize capacity() const { return this->_capacity; }
+
+        /**
+         * @brief Returns the contiguous storage of the elements.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the first element, NULL if nothing was allocated.
+         */
+        inline const T* data() const { return this->_data; }
+
+        /**
+         * @brief Returns the contiguous storage of the elements.
+         *
+         * Complexity: O(1)
+         *
+         * @return A pointer to the first element, NULL if nothing was allocated.
+         */
+        inline T* data() { return this->_data; }
+
+        /**
+         * @brief Get the value of the front element of the vector.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the front element.
+         *
+         * @note it's undefined behavior if vector is empty.
+         */
+        inline const T& front() const { return this->_data[0]; }
+
+        /**
+         * @brief Get the value of the front element of the vector.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the front element.
+         *
+         * @note it's undefined behavior if vector is empty.
+         */
+        inline T& front() { return this->_data[0]; }
+
+        /**
+         * @brief Get the value of the back element of the vector.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the back element.
+         *
+         * @note it's undefined behavior if vector is empty.
+         */
+        inline const T& back() const { return this->_data[this->_len - 1]; }
+
+        /**
+         * @brief Get the value of the back element of the vector.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the value of the back element.
+         *
+         * @note it's undefined behavior if vector is empty.
+         */
+        inline T& back() { return this->_data[this->_len - 1]; }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the vector is empty.
+         */
+        inline iterator begin() { return this->_data; }
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to end() if the vector is empty.
+         */
+        inline const_iterator begin() const { return this->_data; }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline iterator end() { return this->_data + this->_len; }
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator end() const { return this->_data + this->_len; }
+
+        /**
+         * @brief Returns a const iterator to the first element, even if the vector is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to cend() if the vector is empty.
+         */
+        inline const_iterator cbegin() const { return this->begin(); }
+
+        /**
+         * @brief Returns a const iterator past the last element, even if the vector is
+         * mutable.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_iterator cend() const { return this->end(); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the vector is empty.
+         */
+        inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator, equal to rend() if the vector is empty.
+         */
+        inline const_reverse_iterator rbegin() const {
+            return const_reverse_iterator(this->end());
+        }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * Complexity: O(1)
+         *
+         * @return The iterator.
+         */
+        inline const_reverse_iterator rend() const {
+            return const_reverse_iterator(this->begin());
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(1)
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         * @throws std::out_of_range if the specified position is out of range.
+         */
+        const T& at(usize at) const {
+            if (at >= this->_len) {
+                throw std::out_of_range("Vector::at out of range");
+            }
+
+            return this->_data[at];
+        }
+
+        /**
+         * @brief Get the value of the element at the specified position.
+         *
+         * Complexity: O(1)
+         *
+         * @param at The position of the element.
+         * @return A reference to the value of the element at the specified position.
+         * @throws std::out_of_range if the specified position is out of range.
+         */
+        T& at(usize at) {
+            if (at >= this->_len) {
+                throw std::out_of_range("Vector::at out of range");
+            }
+
+            return this->_data[at];
+        }
+
+        /**
+         * @brief Ensures that at least capacity elements fit without growing.
+         *
+         * Complexity: O(n), if the storage has to grow
+         * Complexity: O(1), otherwise
+         *
+         * @param capacity The minimum capacity.
+         */
+        void reserve(usize capacity) {
+            if (capacity > this->_capacity) {
+                this->reallocate(capacity);
+            }
+        }
+
+        /**
+         * @brief Releases the capacity that isn't used by any element.
+         *
+         * Complexity: O(n), if there's unused capacity
+         * Complexity: O(1), otherwise
+         */
+        void shrinkToFit() {
+            if (this->_capacity == this->_len) {
+                return;
+            }
+            if (this->_len == 0) {
+                ::operator delete(this->_data);
+                this->_data = NULL;
+                this->_capacity = 0;
+                return;
+            }
+
+            this->reallocate(this->_len);
+        }
+
+        /**
+         * @brief Adds an element to the end of the vector.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(const T& value) { this->emplaceBack(value); }
+
+        /**
+         * @brief Moves an element to the end of the vector.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be added.
+         */
+        inline void pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
+        /**
+         * @brief Constructs a new element in place at the end of the vector.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param args The arguments forwarded to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            T* ptr;
+
+            if (this->_len == this->_capacity) {
+                // args may live in the storage that is about to be released
+                T value(std::forward<Args>(args)...);
+                this->grow();
+                ptr = new (this->_data + this->_len) T(std::move(value));
+            } else {
+                ptr = new (this->_data + this->_len) T(std::forward<Args>(args)...);
+            }
+
+            this->_len++;
+            return *ptr;
+        }
+
+        /**
+         * @brief Removes and returns the last element of the vector.
+         *
+         * Complexity: O(1)
+         *
+         * @return The value of the removed element.
+         *
+         * @note it's undefined behavior if vector is empty.
+         */
+        T popBack() {
+            this->_len--;
+
+            T* ptr = this->_data + this->_len;
+            T value = std::move(*ptr);
+            ptr->~T();
+
+            return value;
+        }
+
+        /**
+         * @brief Adds a copy of the elements from first to last to the end of the
+         * vector, a forward range is measured first so the storage grows once.
+         *
+         * Complexity: O(m), where m is the length of the range
+         *
+         * @param first The first element to be added.
+         * @param last Past the last element to be added.
+         */
+        template <typename Iterator>
+        void pushBackN(Iterator first, Iterator last) {
+            if constexpr (details::IsForwardIterator<Iterator>::value) {
+                usize count = usize(std::distance(first, last));
+                this->growFor(count);
+            }
+
+            for (; first != last; ++first) {
+                this->emplaceBack(*first);
+            }
+        }
+
+        /**
+         * @brief Removes the last n elements of the vector, moving them to out from
+         * the back on.
+         *
+         * Complexity: O(m), where m is n or the length if it's shorter
+         *
+         * @param out Where the values are written.
+         * @param n The maximum amount of elements to be removed.
+         * @return out past the last written value.
+         */
+        template <typename Output>
+        Output popBackN(Output out, usize n) {
+            usize count = n < this->_len ? n : this->_len;
+            T* top = this->_data + this->_len;
+            usize i = 0;
+
+            try {
+                for (; i < count; i++) {
+                    T* ptr = top - 1 - i;
+                    *out = std::move(*ptr);
+                    ++out;
+                    ptr->~T();
+                }
+            } catch (...) {
+                this->_len -= i;
+                throw;
+            }
+
+            this->_len -= count;
+            return out;
+        }
+
+        /**
+         * @brief Moves the elements of other to the end of this vector, other is
+         * left empty.
+         *
+         * Complexity: O(1), if this vector is empty
+         * Complexity: O(m), otherwise
+         *
+         * @param other The vector to be appended.
+         */
+        void append(Vector<T>& other) {
+            if (this == &other || other.empty()) {
+                return;
+            }
+            if (this->_len == 0) {
+                this->swap(other);
+                return;
+            }
+
+            this->growFor(other._len);
+            details::relocate(this->_data + this->_len, other._data, other._len);
+
+            this->_len += other._len;
+            other._len = 0;
+        }
+
+        /**
+         * @brief Reverses the order of elements in the vector.
+         *
+         * Complexity: O(n)
+         */
+        void reverse() {
+            if (this->_len < 2) {
+                return;
+            }
+
+            for (usize i = 0, j = this->_len - 1; i < j; i++, j--) {
+                std::swap(this->_data[i], this->_data[j]);
+            }
+        }
+
+        /**
+         * @brief Retains only the elements in the vector that match the given
+         * filter function, the remaining ones keep their order.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if
+         * it should be retained, false otherwise.
+         * @return The number of elements that were removed.
+         * @throws Whatever filter throws, the elements removed so far stay removed
+         * and the rest are kept.
+         */
+        template <typename Filter>
+        usize retainIf(Filter filter) {
+            return this->compact([&filter](const T& value) { return !filter(value); });
+        }
+
+        /**
+         * @brief Retains only the elements in the vector that match the given
+         * filter function, the remaining ones keep their order.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if it
+         * should be retained, false otherwise.
+         * @param ctx The context of filter.
+         * @return The number of elements that were removed.
+         * @tparam Context The context data-type
+         */
+        template <typename Filter, typename Context>
+        usize retainIf(Filter filter, Context& ctx) {
+            return this->compact(
+                [&filter, &ctx](const T& value) { return !filter(value, ctx); });
+        }
+
+        /**
+         * @brief Removes all elements from the vector that match the given filter
+         * function, the remaining ones keep their order.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if it
+         * should be removed, false otherwise.
+         * @return The number of elements that were removed.
+         * @throws Whatever filter throws, the elements removed so far stay removed
+         * and the rest are kept.
+         */
+        template <typename Filter>
+        usize removeIf(Filter filter) {
+            return this->compact(filter);
+        }
+
+        /**
+         * @brief Removes all elements from the vector that match the given filter
+         * function, the remaining ones keep their order.
+         *
+         * Complexity: O(n)
+         *
+         * @param filter A filter function that takes an element and returns true if it
+         * should be removed, false otherwise.
+         * @param ctx The context of filter
+         * @return The number of elements that were removed.
+         * @tparam Context The context data-type
+         */
+        template <typename Filter, typename Context>
+        usize removeIf(Filter filter, Context& ctx) {
+            return this->compact(
+                [&filter, &ctx](const T& value) { return filter(value, ctx); });
+        }
+
+        /**
+         * @brief Destroys every element, the storage is kept.
+         *
+         * Complexity: O(n)
+         */
+        void clear() {
+            for (usize i = 0; i < this->_len; i++) {
+                this->_data[i].~T();
+            }
+
+            this->_len = 0;
+        }
+
+        /**
+         * @brief Swaps the contents of this vector with another vector.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(Vector<T>& other) {
+            std::swap(this->_data, other._data);
+            std::swap(this->_capacity, other._capacity);
+            std::swap(this->_len, other._len);
+        }
+
+        /**
+         * @brief Checks if the vector contains a specific value.
+         *
+         * Complexity: O(n / w), see simd::find
+         *
+         * @param value The value to be checked.
+         * @return True if the vector contains the value, false otherwise.
+         */
+        inline bool contains(const T& value) const { return this->find(value) != NO_POS; }
+
+        /**
+         * @brief Counts the occurrences of a specific value in the vector.
+         *
+         * Complexity: O(n / w), see simd::count
+         *
+         * @param value The value to be counted.
+         * @return How many elements are equal to value.
+         */
+        inline usize count(const T& value) const {
+            return simd::count(this->_data, this->_len, value);
+        }
+
+        /**
+         * @brief Finds the first occurrence of a specific value in the vector.
+         *
+         * Complexity: O(n / w), see simd::find
+         *
+         * @param value The value to be found.
+         * @param skip How many elements to ignore.
+         * @return The index of the first occurrence of the value, or NO_POS if not found.
+         */
+        usize find(const T& value, usize skip = 0) const {
+            if (skip >= this->_len) {
+                return NO_POS;
+            }
+
+            usize found = simd::find(this->_data + skip, this->_len - skip, value);
+            return found == NO_POS ? NO_POS : skip + found;
+        }
+
+        /**
+         * @brief Finds the last occurrence of a specific value in the vector.
+         *
+         * Complexity: O(n / w), see simd::rfind
+         *
+         * @param value The value to be found.
+         * @param skip How many elements to ignore from the back.
+         * @return The index of the last occurrence of the value, or NO_POS if not found.
+         */
+        usize rfind(const T& value, usize skip = 0) const {
+            if (skip >= this->_len) {
+                return NO_POS;
+            }
+
+            return simd::rfind(this->_data, this->_len - skip, value);
+        }
+
+        /**
+         * @brief Finds all occurrences of a specific value in the vector.
+         *
+         * Complexity: O(n / w + m), where m is the amount of matches
+         *
+         * @param value The value to be found.
+         * @return A vector of indices where the value is found.
+         */
+        Vector<usize> findAll(const T& value) const {
+            Vector<usize> indices;
+            simd::findEach(this->_data, this->_len, value,
+                           [&indices](usize at) { indices.pushBack(at); });
+            return indices;
+        }
+
+        /**
+         * @brief Adds every element to initial, see simd::sum.
+         *
+         * Complexity: O(n)
+         *
+         * @param initial The initial value, it sets the type of the sum.
+         * @return The sum.
+         */
+        template <typename B = T>
+        inline B sum(B initial = B()) const {
+            return simd::sum(this->_data, this->_len, initial);
+        }
+
+        /**
+         * @brief Returns the smallest element, see simd::min.
+         *
+         * Complexity: O(n)
+         *
+         * @return A copy of the smallest element.
+         *
+         * @note It's undefined behavior, if vector is empty.
+         */
+        inline T min() const { return simd::min(this->_data, this->_len); }
+
+        /**
+         * @brief Returns the greatest element, see simd::max.
+         *
+         * Complexity: O(n)
+         *
+         * @return A copy of the greatest element.
+         *
+         * @note It's undefined behavior, if vector is empty.
+         */
+        inline T max() const { return simd::max(this->_data, this->_len); }
+
+        /**
+         * @brief Returns a reference to the element at the specified position.
+         *
+         * Complexity: O(1)
+         *
+         * @param at The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        inline const T& operator[](usize at) const { return this->_data[at]; }
+
+        /**
+         * @brief Returns a reference to the element at the specified position.
+         *
+         * Complexity: O(1)
+         *
+         * @param at The position of the element to access.
+         * @return A reference to the element at the specified position.
+         *
+         * @note it's undefined behavior if at is out of range.
+         */
+        inline T& operator[](usize at) { return this->_data[at]; }
+
+        /**
+         * @brief Concatenates this vector with another vector and returns a new
+         * vector.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The vector to concatenate with.
+         * @return A new vector that contains elements from both vectors.
+         */
+        Vector<T> operator+(const Vector<T>& other) const {
+            Vector<T> vector;
+            vector.reserve(this->_len + other._len);
+            vector += *this;
+            vector += other;
+            return vector;
+        }
+
+        /**
+         * @brief Appends a copy of the elements of another vector to this vector.
+         *
+         * Complexity: O(m)
+         *
+         * @param other The vector to append.
+         * @return A reference to this vector after the append operation.
+         */
+        Vector<T>& operator+=(const Vector<T>& other) {
+            if (this == &other) {
+                Vector<T> copy(other);
+                return *this += copy;
+            }
+
+            this->growFor(other._len);
+            for (usize i = 0; i < other._len; i++) {
+                new (this->_data + this->_len) T(other._data[i]);
+                this->_len++;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Checks if two vectors hold the same elements in the same order.
+         *
+         * Complexity: O(n / w), see simd::equal
+         *
+         * @param other The vector to compare with.
+         * @return True if the vectors are equal, false otherwise.
+         */
+        bool operator==(const Vector<T>& other) const {
+            if (this == &other) {
+                return true;
+            }
+            if (this->_len != other._len) {
+                return false;
+            }
+
+            return simd::equal(this->_data, other._data, this->_len);
+        }
+
+        /**
+         * @brief Checks if two vectors are not equal.
+         *
+         * Complexity: O(n)
+         *
+         * @param other The vector to compare with.
+         * @return True if the vectors are not equal, false otherwise.
+         */
+        inline bool operator!=(const Vector<T>& other) const { return !(*this == other); }
+
+        /**
+         * @brief Assigns a copy of the contents of another vector to this vector.
+         *
+         * Complexity: O(n + m)
+         *
+         * @param other The vector to assign from.
+         * @return A reference to this vector.
+         */
+        Vector<T>& operator=(const Vector<T>& other) {
+            if (this != &other) {
+                this->clear();
+                *this += other;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Takes over the storage of another vector, which is left empty.
+         *
+         * Complexity: O(n), as the current elements are destroyed
+         *
+         * @param other The vector to move from.
+         * @return A reference to this vector.
+         */
+        Vector<T>& operator=(Vector<T>&& other) {
+            if (this != &other) {
+                this->clear();
+                this->swap(other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Overloads the output stream operator to print the vector as a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param out The output stream.
+         * @param vector The vector to print.
+         * @return The output stream after printing the vector.
+         */
+        friend std::ostream& operator<<(std::ostream& out, const Vector<T>& vector) {
+            return details::writeSequence(out, vector);
+        }
+
+        /**
+         * @brief Overloads the input stream operator to get the vector from a string
+         * representation.
+         *
+         * Complexity: O(n)
+         *
+         * @param in The input stream.
+         * @param vector The vector to fill.
+         * @return The input stream.
+         */
+        friend std::istream& operator>>(std::istream& in, Vector<T>& vector) {
+            return details::readSequence<T>(in, vector);
+        }
+
+      private:
+        /**
+         * @brief Destroys the elements matching remove and slides the rest down
+         * over the holes, in a single pass.
+         *
+         * Complexity: O(n)
+         *
+         * @param remove Returns true for the elements to be destroyed.
+         * @return The number of elements that were removed.
+         * @throws Whatever remove throws, the unvisited elements are slid down
+         * first so the vector stays contiguous.
+         */
+        template <typename Predicate>
+        usize compact(Predicate remove) {
+            usize written = 0;
+            usize i = 0;
+
+            try {
+                for (; i < this->_len; i++) {
+                    T* ptr = this->_data + i;
+                    if (remove(*ptr)) {
+                        ptr->~T();
+                    } else {
+                        if (written != i) {
+                            details::relocate(this->_data + written, ptr, 1);
+                        }
+                        written++;
+                    }
+                }
+            } catch (...) {
+                for (usize j = i; j < this->_len; j++, written++) {
+                    if (written != j) {
+                        details::relocate(this->_data + written, this->_data + j, 1);
+                    }
+                }
+                this->_len = written;
+                throw;
+            }
+
+            usize removed = this->_len - written;
+            this->_len = written;
+            return removed;
+        }
+
+        /**
+         * @brief Doubles the capacity of the storage.
+         *
+         * Complexity: O(n)
+         */
+        inline void grow() {
+            this->reallocate(this->_capacity > 0 ? this->_capacity * 2
+                                                 : VECTOR_MIN_CAPACITY);
+        }
+
+        /**
+         * @brief Makes room for count more elements, at least doubling the capacity
+         * when it grows, so repeated appends stay amortized O(1) per element.
+         *
+         * Complexity: O(n), if it has to grow
+         * Complexity: O(1), otherwise
+         *
+         * @param count The number of elements about to be added.
+         */
+        void growFor(usize count) {
+            usize needed = this->_len + count;
+            if (needed <= this->_capacity) {
+                return;
+            }
+
+            usize capacity = this->_capacity > 0 ? this->_capacity * 2
+                                                 : VECTOR_MIN_CAPACITY;
+            this->reallocate(capacity > needed ? capacity : needed);
+        }
+
+        /**
+         * @brief Moves every element into a new storage of the given capacity.
+         *
+         * Complexity: O(n)
+         *
+         * @param capacity The new capacity, it must fit every element.
+         */
+        void reallocate(usize capacity) {
+            T* data = static_cast<T*>(::operator new(sizeof(T) * capacity));
+            details::relocate(data, this->_data, this->_len);
+
+            ::operator delete(this->_data);
+            this->_data = data;
+            this->_capacity = capacity;
+        }
+
+      private:
+        /**
+         * @brief The storage of the elements.
+         */
+        T* _data;
+        /**
+         * @brief The capacity of the storage.
+         */
+        usize _capacity;
+        /**
+         * @brief The amount of elements.
+         */
+        usize _len;
+    };
+
+} // namespace own
+
+#endif // VECTOR_GUARD_HEADER
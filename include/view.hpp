@@ -0,0 +1,511 @@
+#ifndef VIEW_GUARD_HEADER
+#define VIEW_GUARD_HEADER
+
+#include "list.hpp"
+#include "vector.hpp"
+
+// std::pair, std::move and std::forward
+#include <utility>
+// std::invoke_result and std::decay
+#include <type_traits>
+// std::iterator_traits
+#include <iterator>
+
+namespace own {
+
+    template <typename Stage>
+    class View;
+
+    namespace details {
+
+        /**
+         * @brief The first stage of every view, the elements from first to last.
+         *
+         * Every stage hands each element it produces to a sink, a callable returning
+         * false once it doesn't want more. Stages are nested into each other at
+         * compile time, so running a view is a single loop over the source with
+         * every stage inlined in its body.
+         */
+        template <typename Iterator>
+        class RangeStage {
+          public:
+            typedef typename std::iterator_traits<Iterator>::reference reference;
+            typedef typename std::iterator_traits<Iterator>::value_type value_type;
+
+            RangeStage(Iterator first, Iterator last) : first(first), last(last) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                for (Iterator it = this->first; it != this->last; ++it) {
+                    if (!sink(*it)) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+          private:
+            Iterator first;
+            Iterator last;
+        };
+
+        /**
+         * @brief Passes on the elements the predicate returns true for.
+         */
+        template <typename Source, typename Predicate>
+        class FilterStage {
+          public:
+            typedef typename Source::reference reference;
+            typedef typename Source::value_type value_type;
+
+            FilterStage(const Source& source, Predicate predicate)
+                : source(source), predicate(predicate) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                auto filter = [this, &sink](auto&& value) {
+                    return !this->predicate(value) ||
+                           sink(std::forward<decltype(value)>(value));
+                };
+
+                return this->source.run(filter);
+            }
+
+          private:
+            Source source;
+            Predicate predicate;
+        };
+
+        /**
+         * @brief Passes on what the function returns for every element.
+         */
+        template <typename Source, typename Function>
+        class MapStage {
+          public:
+            typedef
+                typename std::invoke_result<Function&, typename Source::reference>::type
+                    reference;
+            typedef typename std::decay<reference>::type value_type;
+
+            MapStage(const Source& source, Function function)
+                : source(source), function(function) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                auto map = [this, &sink](auto&& value) {
+                    return sink(this->function(std::forward<decltype(value)>(value)));
+                };
+
+                return this->source.run(map);
+            }
+
+          private:
+            Source source;
+            Function function;
+        };
+
+        /**
+         * @brief Passes on the first n elements, the source stops right after.
+         */
+        template <typename Source>
+        class TakeStage {
+          public:
+            typedef typename Source::reference reference;
+            typedef typename Source::value_type value_type;
+
+            TakeStage(const Source& source, usize n) : source(source), n(n) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                if (this->n == 0) {
+                    return true;
+                }
+
+                usize taken = 0;
+                auto take = [this, &sink, &taken](auto&& value) {
+                    return sink(std::forward<decltype(value)>(value)) &&
+                           ++taken < this->n;
+                };
+
+                return this->source.run(take) || taken == this->n;
+            }
+
+          private:
+            Source source;
+            usize n;
+        };
+
+        /**
+         * @brief Drops the first n elements and passes on the rest.
+         */
+        template <typename Source>
+        class SkipStage {
+          public:
+            typedef typename Source::reference reference;
+            typedef typename Source::value_type value_type;
+
+            SkipStage(const Source& source, usize n) : source(source), n(n) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                usize skipped = 0;
+                auto skip = [this, &sink, &skipped](auto&& value) {
+                    if (skipped < this->n) {
+                        skipped++;
+                        return true;
+                    }
+
+                    return sink(std::forward<decltype(value)>(value));
+                };
+
+                return this->source.run(skip);
+            }
+
+          private:
+            Source source;
+            usize n;
+        };
+
+        /**
+         * @brief Passes on pairs of an element and the element of another range at
+         * the same position, it stops with the shortest of both.
+         */
+        template <typename Source, typename Iterator>
+        class ZipStage {
+            typedef typename Source::value_type First;
+            typedef typename std::iterator_traits<Iterator>::value_type Second;
+
+          public:
+            typedef std::pair<const First&, const Second&> reference;
+            typedef std::pair<First, Second> value_type;
+
+            ZipStage(const Source& source, Iterator first, Iterator last)
+                : source(source), first(first), last(last) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                Iterator it = this->first;
+                if (it == this->last) {
+                    return true;
+                }
+
+                auto zip = [this, &sink, &it](auto&& value) {
+                    const First& first = value;
+                    if (!sink(reference(first, *it))) {
+                        return false;
+                    }
+
+                    return ++it != this->last;
+                };
+
+                return this->source.run(zip) || it == this->last;
+            }
+
+          private:
+            Source source;
+            Iterator first;
+            Iterator last;
+        };
+
+        /**
+         * @brief Passes on the elements in groups of n, the last one may be shorter.
+         *
+         * The group is a Vector reused by every chunk, so one allocation is done per
+         * run and not per chunk. Its elements are valid until the sink returns.
+         */
+        template <typename Source>
+        class ChunkStage {
+            typedef typename Source::value_type Element;
+
+          public:
+            typedef const Vector<Element>& reference;
+            typedef Vector<Element> value_type;
+
+            ChunkStage(const Source& source, usize n) : source(source), n(n) {}
+
+            template <typename Sink>
+            bool run(Sink& sink) {
+                if (this->n == 0) {
+                    return true;
+                }
+
+                Vector<Element> chunk;
+                chunk.reserve(this->n);
+
+                auto group = [this, &sink, &chunk](auto&& value) {
+                    chunk.emplaceBack(std::forward<decltype(value)>(value));
+                    if (chunk.len() < this->n) {
+                        return true;
+                    }
+
+                    bool more = sink(static_cast<const Vector<Element>&>(chunk));
+                    chunk.clear();
+                    return more;
+                };
+
+                if (!this->source.run(group)) {
+                    return false;
+                }
+
+                return chunk.empty() || sink(static_cast<const Vector<Element>&>(chunk));
+            }
+
+          private:
+            Source source;
+            usize n;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief A lazy pipeline over the elements of a container.
+     *
+     * Adapters (filter, map, take, skip, zip and chunk) only describe the pipeline,
+     * nothing runs nor allocates until a terminal operation (forEach, fold, count or
+     * collect) walks the container once, passing every element through all of
+     * them:
+     *
+     *     // one pass over the nodes, no intermediate list
+     *     int total = own::view(list)
+     *                     .filter([](const Order& o) { return o.open; })
+     *                     .map([](const Order& o) { return o.amount; })
+     *                     .fold([](int amount, int& sum) { sum += amount; }, 0);
+     *
+     * A view refers to the container, which must outlive it and stay untouched
+     * while it runs.
+     *
+     * @tparam Stage The last stage of the pipeline.
+     */
+    template <typename Stage>
+    class View {
+      public:
+        /**
+         * @brief What the elements of the view are passed as.
+         */
+        typedef typename Stage::reference reference;
+        /**
+         * @brief The type of the elements, what collect stores.
+         */
+        typedef typename Stage::value_type value_type;
+
+        /**
+         * @brief Constructs a view from its last stage, see own::view.
+         *
+         * Complexity: O(1)
+         */
+        explicit View(const Stage& stage) : stage(stage) {}
+
+        /**
+         * @brief Keeps the elements the predicate returns true for.
+         *
+         * Complexity: O(1), the predicate is called while the view runs
+         *
+         * @param predicate The callable taking a const reference to an element.
+         * @return The filtered view.
+         */
+        template <typename Predicate>
+        View<details::FilterStage<Stage, Predicate> > filter(Predicate predicate) const {
+            return View<details::FilterStage<Stage, Predicate> >(
+                details::FilterStage<Stage, Predicate>(this->stage, predicate));
+        }
+
+        /**
+         * @brief Replaces every element by what the function returns for it.
+         *
+         * Complexity: O(1), the function is called while the view runs
+         *
+         * @param function The callable taking an element.
+         * @return The mapped view.
+         */
+        template <typename Function>
+        View<details::MapStage<Stage, Function> > map(Function function) const {
+            return View<details::MapStage<Stage, Function> >(
+                details::MapStage<Stage, Function>(this->stage, function));
+        }
+
+        /**
+         * @brief Keeps the first n elements, the container isn't walked further.
+         *
+         * Complexity: O(1)
+         *
+         * @param n The maximum amount of elements.
+         * @return The truncated view.
+         */
+        View<details::TakeStage<Stage> > take(usize n) const {
+            return View<details::TakeStage<Stage> >(
+                details::TakeStage<Stage>(this->stage, n));
+        }
+
+        /**
+         * @brief Drops the first n elements.
+         *
+         * Complexity: O(1)
+         *
+         * @param n The amount of elements to be dropped.
+         * @return The view of the rest.
+         */
+        View<details::SkipStage<Stage> > skip(usize n) const {
+            return View<details::SkipStage<Stage> >(
+                details::SkipStage<Stage>(this->stage, n));
+        }
+
+        /**
+         * @brief Pairs every element with the element of another container at the
+         * same position, the view ends with the shortest of both.
+         *
+         * Complexity: O(1)
+         *
+         * @param other The container walked alongside, elements are passed as a
+         * std::pair of const references.
+         * @return The zipped view.
+         */
+        template <typename Container>
+        auto zip(Container& other) const {
+            typedef decltype(other.begin()) Iterator;
+            return View<details::ZipStage<Stage, Iterator> >(
+                details::ZipStage<Stage, Iterator>(this->stage, other.begin(),
+                                                   other.end()));
+        }
+
+        /**
+         * @brief Groups the elements in chunks of n, the last one holds what's left.
+         *
+         * Complexity: O(1)
+         *
+         * @param n The length of the chunks, a view of no chunk if it's 0.
+         * @return The view of the chunks, passed as a const Vector& valid until the
+         * next one.
+         */
+        View<details::ChunkStage<Stage> > chunk(usize n) const {
+            return View<details::ChunkStage<Stage> >(
+                details::ChunkStage<Stage>(this->stage, n));
+        }
+
+        /**
+         * @brief Calls the action with every element of the view.
+         *
+         * Complexity: O(n), where n is the length of the container
+         *
+         * @param action The callable taking an element.
+         */
+        template <typename Action>
+        void forEach(Action action) {
+            auto sink = [&action](auto&& value) {
+                action(std::forward<decltype(value)>(value));
+                return true;
+            };
+
+            this->stage.run(sink);
+        }
+
+        /**
+         * @brief Folds the elements of the view, as List::fold does.
+         *
+         * Complexity: O(n), where n is the length of the container
+         *
+         * @param action The callable taking an element and a B&.
+         * @param initial The initial value for folding.
+         * @return The final folded value.
+         */
+        template <typename B, typename Action>
+        B fold(Action action, B initial) {
+            auto sink = [&action, &initial](auto&& value) {
+                action(std::forward<decltype(value)>(value), initial);
+                return true;
+            };
+
+            this->stage.run(sink);
+            return initial;
+        }
+
+        /**
+         * @brief Counts the elements of the view.
+         *
+         * Complexity: O(n), where n is the length of the container
+         *
+         * @return The amount of elements.
+         */
+        usize count() {
+            usize count = 0;
+            auto sink = [&count](auto&&) {
+                count++;
+                return true;
+            };
+
+            this->stage.run(sink);
+            return count;
+        }
+
+        /**
+         * @brief Adds the elements of the view to the end of a container.
+         *
+         * Complexity: O(n), where n is the length of the source container
+         *
+         * @param into The container, with a pushBack.
+         * @return A reference to into.
+         */
+        template <typename Container>
+        Container& collect(Container& into) {
+            auto sink = [&into](auto&& value) {
+                into.pushBack(std::forward<decltype(value)>(value));
+                return true;
+            };
+
+            this->stage.run(sink);
+            return into;
+        }
+
+        /**
+         * @brief Materializes the view into a new container.
+         *
+         * Complexity: O(n), where n is the length of the source container
+         *
+         * @return The container holding the elements of the view.
+         * @tparam Container List<value_type> by default.
+         */
+        template <typename Container = List<value_type> >
+        Container collect() {
+            Container into;
+            this->collect(into);
+            return into;
+        }
+
+      private:
+        Stage stage;
+    };
+
+    /**
+     * @brief Returns a lazy view of the elements of a container, in the order its
+     * iterators walk them, so a Stack is viewed from the top down.
+     *
+     * Complexity: O(1)
+     *
+     * @param container The container, it must outlive the view.
+     * @return The view of every element.
+     */
+    template <typename Container>
+    auto view(Container& container) {
+        typedef decltype(container.begin()) Iterator;
+        return View<details::RangeStage<Iterator> >(
+            details::RangeStage<Iterator>(container.begin(), container.end()));
+    }
+
+    /**
+     * @brief Returns a lazy view of the elements from first to last.
+     *
+     * Complexity: O(1)
+     *
+     * @param first The first element.
+     * @param last Past the last element.
+     * @return The view of the range.
+     */
+    template <typename Iterator>
+    View<details::RangeStage<Iterator> > view(Iterator first, Iterator last) {
+        return View<details::RangeStage<Iterator> >(
+            details::RangeStage<Iterator>(first, last));
+    }
+
+} // namespace own
+
+#endif // VIEW_GUARD_HEADER
@@ -0,0 +1,361 @@
+#ifndef WINDOW_GUARD_HEADER
+#define WINDOW_GUARD_HEADER
+
+#include "ring_buffer.hpp"
+
+// std::next and std::prev
+#include <iterator>
+
+namespace own {
+
+    /**
+     * @brief A window of consecutive elements of a container, it refers to the
+     * elements in place, nothing is copied.
+     *
+     * @tparam Iterator The iterator of the container.
+     */
+    template <typename Iterator>
+    class WindowView {
+      public:
+        /**
+         * @brief Constructs a view of the elements from first to last.
+         *
+         * Complexity: O(1)
+         *
+         * @param first The first element of the window.
+         * @param last Past the last element of the window.
+         * @param len The amount of elements between first and last.
+         */
+        WindowView(Iterator first, Iterator last, usize len)
+            : first(first), last(last), _len(len) {}
+
+        /**
+         * @brief Returns the amount of elements in the window.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the window.
+         */
+        inline usize len() const { return this->_len; }
+
+        /**
+         * @brief Returns the oldest element of the window, the one leaving next.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the first element.
+         */
+        inline decltype(auto) front() const { return *this->first; }
+
+        /**
+         * @brief Returns the newest element of the window.
+         *
+         * Complexity: O(1)
+         *
+         * @return A reference to the last element.
+         */
+        inline decltype(auto) back() const { return *std::prev(this->last); }
+
+        /**
+         * @brief Returns an iterator to the first element of the window.
+         *
+         * Complexity: O(1)
+         */
+        inline Iterator begin() const { return this->first; }
+
+        /**
+         * @brief Returns an iterator past the last element of the window.
+         *
+         * Complexity: O(1)
+         */
+        inline Iterator end() const { return this->last; }
+
+      private:
+        Iterator first;
+        Iterator last;
+        usize _len;
+    };
+
+    /**
+     * @brief The running sum of a sliding window, it can be passed to sliding::fold.
+     *
+     * Every aggregate of a window provides push for the element entering the
+     * window, pop for the element leaving it and value.
+     *
+     * @note Floating point sums drift as elements are added and subtracted, for long
+     * runs a wider S (double for float samples) keeps the error down.
+     *
+     * @tparam T The type of the elements.
+     * @tparam S The type of the sum, T by default.
+     */
+    template <typename T, typename S = T>
+    class RunningSum {
+      public:
+        /**
+         * @brief Constructs the sum of an empty window.
+         *
+         * Complexity: O(1)
+         */
+        RunningSum() : sum(), count(0) {}
+
+        /**
+         * @brief Adds an element entering the window.
+         *
+         * Complexity: O(1)
+         */
+        inline void push(const T& value) {
+            this->sum += value;
+            this->count++;
+        }
+
+        /**
+         * @brief Subtracts an element leaving the window.
+         *
+         * Complexity: O(1)
+         */
+        inline void pop(const T& value) {
+            this->sum -= value;
+            this->count--;
+        }
+
+        /**
+         * @brief Returns the amount of elements in the window.
+         *
+         * Complexity: O(1)
+         */
+        inline usize len() const { return this->count; }
+
+        /**
+         * @brief Returns the sum of the window.
+         *
+         * Complexity: O(1)
+         */
+        inline const S& value() const { return this->sum; }
+
+        /**
+         * @brief Returns the average of the window, a moving average while sliding.
+         *
+         * Complexity: O(1)
+         *
+         * @note It's undefined behavior if the window is empty.
+         */
+        inline S mean() const { return this->sum / S(this->count); }
+
+      private:
+        S sum;
+        usize count;
+    };
+
+    namespace details {
+
+        /**
+         * @brief A monotonic queue of the window, the candidates for its minimum (or
+         * maximum) in the order they entered.
+         *
+         * Every element is pushed and popped at most once, so it's amortized O(1)
+         * per element.
+         *
+         * @tparam T The type of the elements.
+         * @tparam Max False to track the minimum, true for the maximum.
+         */
+        template <typename T, bool Max>
+        class RunningExtreme {
+          public:
+            /**
+             * @brief Constructs the extreme of an empty window.
+             *
+             * Complexity: O(1)
+             *
+             * @param capacity The length of the window, storage for it is reserved
+             * up front so sliding never allocates.
+             */
+            explicit RunningExtreme(usize capacity) : candidates(capacity) {}
+
+            /**
+             * @brief Adds an element entering the window, dropping every candidate
+             * it beats.
+             *
+             * Complexity: O(1), amortized
+             */
+            void push(const T& value) {
+                // equal candidates are kept, so pop knows how many leave
+                while (!this->candidates.empty() &&
+                       beats(value, this->candidates.back())) {
+                    this->candidates.popBack();
+                }
+
+                this->candidates.pushBack(value);
+            }
+
+            /**
+             * @brief Removes an element leaving the window.
+             *
+             * Complexity: O(1)
+             *
+             * @param value The oldest element of the window.
+             */
+            void pop(const T& value) {
+                if (!this->candidates.empty() &&
+                    !beats(this->candidates.front(), value)) {
+                    this->candidates.popFront();
+                }
+            }
+
+            /**
+             * @brief Returns the extreme of the window.
+             *
+             * Complexity: O(1)
+             *
+             * @note It's undefined behavior if the window is empty.
+             */
+            inline const T& value() const { return this->candidates.front(); }
+
+          private:
+            static inline bool beats(const T& a, const T& b) {
+                if constexpr (Max) {
+                    return b < a;
+                } else {
+                    return a < b;
+                }
+            }
+
+          private:
+            RingBuffer<T> candidates;
+        };
+
+    } // namespace details
+
+    /**
+     * @brief The running minimum of a sliding window, it can be passed to
+     * sliding::fold. T must provide operator<.
+     *
+     * @tparam T The type of the elements.
+     */
+    template <typename T>
+    class RunningMin : public details::RunningExtreme<T, false> {
+      public:
+        /**
+         * @brief Constructs the minimum of an empty window.
+         *
+         * Complexity: O(1)
+         *
+         * @param capacity The length of the window, reserved up front.
+         */
+        explicit RunningMin(usize capacity = 0)
+            : details::RunningExtreme<T, false>(capacity) {}
+    };
+
+    /**
+     * @brief The running maximum of a sliding window, it can be passed to
+     * sliding::fold. T must provide operator<.
+     *
+     * @tparam T The type of the elements.
+     */
+    template <typename T>
+    class RunningMax : public details::RunningExtreme<T, true> {
+      public:
+        /**
+         * @brief Constructs the maximum of an empty window.
+         *
+         * Complexity: O(1)
+         *
+         * @param capacity The length of the window, reserved up front.
+         */
+        explicit RunningMax(usize capacity = 0)
+            : details::RunningExtreme<T, true>(capacity) {}
+    };
+
+    /**
+     * @brief Streaming sliding windows over any container.
+     *
+     * Windows refer to the elements of the container through two iterators, one
+     * entering and one leaving, so nothing is shifted nor copied and results go
+     * straight to a caller provided sink instead of a new container.
+     *
+     * Usage:
+     *
+     *     own::RunningSum<double> sum;
+     *     own::sliding::fold(samples, 50, sum, [&](const own::RunningSum<double>& s) {
+     *         averages.pushBack(s.mean());
+     *     });
+     */
+    namespace sliding {
+
+        /**
+         * @brief Calls the action with a view of every window of n elements, from
+         * the front to the back.
+         *
+         * Complexity: O(m), where m is the length of the container, plus whatever
+         * the action does with each view
+         *
+         * @param container The container to be walked.
+         * @param n The length of the windows, nothing is called if it's 0 or larger
+         * than the container.
+         * @param action The callable taking a const WindowView&.
+         */
+        template <typename Container, typename Action>
+        void forEach(Container& container, usize n, Action action) {
+            if (n == 0 || n > container.len()) {
+                return;
+            }
+
+            auto first = container.begin();
+            auto last = std::next(first, n);
+            auto end = container.end();
+
+            for (;;) {
+                action(WindowView<decltype(first)>(first, last, n));
+
+                if (last == end) {
+                    return;
+                }
+                ++first;
+                ++last;
+            }
+        }
+
+        /**
+         * @brief Slides an aggregate over every window of n elements and hands it to
+         * the sink once per window.
+         *
+         * Complexity: O(m), where m is the length of the container, if the aggregate
+         * is amortized O(1) as RunningSum, RunningMin and RunningMax are
+         *
+         * @param container The container to be walked.
+         * @param n The length of the windows, the sink is not called if it's 0 or
+         * larger than the container.
+         * @param aggregate Provides push(element), pop(element) and value(), it's
+         * left holding the last window.
+         * @param sink The callable taking a const reference to the aggregate.
+         */
+        template <typename Container, typename Aggregate, typename Sink>
+        void fold(Container& container, usize n, Aggregate& aggregate, Sink sink) {
+            if (n == 0) {
+                return;
+            }
+
+            auto leaving = container.begin();
+            auto end = container.end();
+            usize count = 0;
+
+            for (auto it = leaving; it != end; ++it) {
+                if (count < n) {
+                    count++;
+                } else {
+                    aggregate.pop(*leaving);
+                    ++leaving;
+                }
+
+                aggregate.push(*it);
+
+                if (count == n) {
+                    sink(static_cast<const Aggregate&>(aggregate));
+                }
+            }
+        }
+
+    } // namespace sliding
+
+} // namespace own
+
+#endif // WINDOW_GUARD_HEADER
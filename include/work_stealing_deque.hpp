@@ -0,0 +1,251 @@
+#ifndef WORK_STEALING_DEQUE_GUARD_HEADER
+#define WORK_STEALING_DEQUE_GUARD_HEADER
+
+#include "core.hpp"
+
+// std::atomic
+#include <atomic>
+// std::is_trivially_copyable
+#include <type_traits>
+
+namespace own {
+
+    /**
+     * @brief Initial capacity of a WorkStealingDeque, it doubles when it's full.
+     */
+    const usize WORK_STEALING_DEQUE_CAPACITY = 64;
+
+    /**
+     * @brief A Chase-Lev work-stealing deque.
+     *
+     * The owner thread uses the bottom end as a Stack, push and pop are LIFO and
+     * only race with thieves for the very last element. Any other thread
+     * steals from the top end as a Queue does, FIFO, so thieves take the oldest
+     * and usually largest pieces of work.
+     *
+     * The ring grows when it's full, older rings are kept until the destructor
+     * since a thief may still be reading one of them.
+     *
+     * @note Thieves copy an element before knowing if the steal succeeded, so T
+     * must be trivially copyable, typically a pointer to a task.
+     *
+     * @tparam T The type of the elements.
+     */
+    template <typename T>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "elements are read speculatively, T must be trivially copyable");
+
+      public:
+        /**
+         * @brief Constructs an empty deque.
+         *
+         * Complexity: O(n)
+         *
+         * @param capacity How many elements fit before growing, rounded up to a
+         * power of two.
+         */
+        explicit WorkStealingDeque(usize capacity = WORK_STEALING_DEQUE_CAPACITY)
+            : top(0), bottom(0) {
+            this->ring.store(new Ring(details::nextPowerOfTwo(capacity), NULL),
+                             std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Destructor, releases the current and every outgrown ring.
+         *
+         * Complexity: O(log n)
+         *
+         * @note No thread may be using the deque anymore.
+         */
+        ~WorkStealingDeque() {
+            Ring* it = this->ring.load(std::memory_order_relaxed);
+            while (it) {
+                Ring* previous = it->previous;
+                delete it;
+                it = previous;
+            }
+        }
+
+        /**
+         * @brief Returns the number of elements in the deque.
+         *
+         * Complexity: O(1)
+         *
+         * @return The length of the deque, it may be outdated as soon as it's
+         * returned if thieves are stealing.
+         */
+        inline usize len() const {
+            isize top = this->top.load(std::memory_order_relaxed);
+            isize bottom = this->bottom.load(std::memory_order_relaxed);
+            return bottom > top ? usize(bottom - top) : 0;
+        }
+
+        /**
+         * @brief Checks if the deque is empty.
+         *
+         * Complexity: O(1)
+         *
+         * @return True if the deque is empty, it may be outdated as soon as it's
+         * returned if thieves are stealing.
+         */
+        inline bool empty() const { return this->len() == 0; }
+
+        /**
+         * @brief Pushes an element at the bottom. Only the owner may call it.
+         *
+         * Complexity: O(1), amortized
+         *
+         * @param value The value to be pushed.
+         * @throws std::bad_alloc if the ring is full and cannot grow.
+         */
+        void push(T value) {
+            isize bottom = this->bottom.load(std::memory_order_relaxed);
+            isize top = this->top.load(std::memory_order_acquire);
+            Ring* ring = this->ring.load(std::memory_order_relaxed);
+
+            if (usize(bottom - top) > ring->mask) {
+                ring = this->grow(ring, top, bottom);
+            }
+
+            ring->put(bottom, value);
+            this->bottom.store(bottom + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Pops the element at the bottom, the newest one. Only the owner may
+         * call it.
+         *
+         * Complexity: O(1)
+         *
+         * @param out Where the value is written to.
+         * @return True if an element was popped, false if the deque was empty or a
+         * thief took the last element.
+         */
+        bool pop(T& out) {
+            isize bottom = this->bottom.load(std::memory_order_relaxed) - 1;
+            Ring* ring = this->ring.load(std::memory_order_relaxed);
+
+            // claim the bottom before reading the top, thieves do the opposite
+            this->bottom.store(bottom, std::memory_order_seq_cst);
+            isize top = this->top.load(std::memory_order_seq_cst);
+
+            if (top > bottom) {
+                this->bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = ring->get(bottom);
+            if (top < bottom) {
+                return true;
+            }
+
+            // the last element, a thief may be after it as well
+            bool won = this->top.compare_exchange_strong(top, top + 1,
+                                                         std::memory_order_seq_cst,
+                                                         std::memory_order_relaxed);
+            this->bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return won;
+        }
+
+        /**
+         * @brief Steals the element at the top, the oldest one. Any thread may call
+         * it.
+         *
+         * Complexity: O(1), lock-free
+         *
+         * @param out Where the value is written to.
+         * @return True if an element was stolen, false if the deque was empty or
+         * another thread took the element first.
+         */
+        bool steal(T& out) {
+            isize top = this->top.load(std::memory_order_seq_cst);
+            isize bottom = this->bottom.load(std::memory_order_seq_cst);
+
+            if (top >= bottom) {
+                return false;
+            }
+
+            Ring* ring = this->ring.load(std::memory_order_acquire);
+            T value = ring->get(top);
+
+            if (!this->top.compare_exchange_strong(top, top + 1,
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed)) {
+                return false;
+            }
+
+            out = value;
+            return true;
+        }
+
+      private:
+        /**
+         * @brief A power of two sized ring, indexed by the unwrapped positions.
+         */
+        struct Ring {
+            Ring(usize capacity, Ring* previous)
+                : slots(new std::atomic<T>[capacity]), mask(capacity - 1),
+                  previous(previous) {}
+
+            ~Ring() { delete[] this->slots; }
+
+            inline T get(isize at) const {
+                return this->slots[usize(at) & this->mask].load(
+                    std::memory_order_relaxed);
+            }
+            inline void put(isize at, T value) {
+                this->slots[usize(at) & this->mask].store(value,
+                                                          std::memory_order_relaxed);
+            }
+
+            std::atomic<T>* slots;
+            usize mask;
+            /**
+             * @brief The outgrown ring, kept alive for late thieves.
+             */
+            Ring* previous;
+        };
+
+        /**
+         * @brief Replaces a full ring with one twice as large.
+         *
+         * Complexity: O(n)
+         *
+         * @return The new ring.
+         */
+        Ring* grow(Ring* ring, isize top, isize bottom) {
+            Ring* bigger = new Ring((ring->mask + 1) * 2, ring);
+            for (isize at = top; at < bottom; at++) {
+                bigger->put(at, ring->get(at));
+            }
+
+            this->ring.store(bigger, std::memory_order_release);
+            return bigger;
+        }
+
+        /**
+         * @brief Deques cannot be copied.
+         */
+        WorkStealingDeque(const WorkStealingDeque<T>&) = delete;
+        void operator=(const WorkStealingDeque<T>&) = delete;
+
+      private:
+        /**
+         * @brief The next position to be stolen, shared by every thread.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<isize> top;
+        /**
+         * @brief The next position to be pushed, written by the owner only.
+         */
+        alignas(CACHE_LINE_SIZE) std::atomic<isize> bottom;
+        /**
+         * @brief The current ring.
+         */
+        std::atomic<Ring*> ring;
+    };
+
+} // namespace own
+
+#endif // WORK_STEALING_DEQUE_GUARD_HEADER
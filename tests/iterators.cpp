@@ -0,0 +1,132 @@
+/**
+ * Compile and run checks of the iterators of the containers: a mutable iterator
+ * converts into a const one, never the other way around, and both kinds compare
+ * with each other from either side, as the standard containers allow.
+ */
+
+#include "intrusive_list.hpp"
+#include "list.hpp"
+#include "mapped_list.hpp"
+#include "reversible_list.hpp"
+#include "ring_buffer.hpp"
+#include "static_list.hpp"
+#include "unrolled_list.hpp"
+#include "vector.hpp"
+
+// std::find
+#include <algorithm>
+// std::printf
+#include <cstdio>
+// std::is_convertible
+#include <type_traits>
+
+namespace {
+
+    int failures = 0;
+
+#define ITERATORS_CHECK(condition)                                                     \
+    do {                                                                               \
+        if (!(condition)) {                                                            \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);  \
+            failures++;                                                                \
+        }                                                                              \
+    } while (0)
+
+    /**
+     * @brief Checks the conversions and the mixed comparisons of a container
+     * holding 1, 2 and 3.
+     */
+    template <typename Container>
+    void mixed(Container& container) {
+        typedef typename Container::iterator Iterator;
+        typedef typename Container::const_iterator ConstIterator;
+
+        static_assert(std::is_convertible<Iterator, ConstIterator>::value,
+                      "a mutable iterator must convert into a const one");
+        static_assert(!std::is_convertible<ConstIterator, Iterator>::value,
+                      "a const iterator must not convert into a mutable one");
+
+        const Container& view = container;
+
+        ITERATORS_CHECK(container.begin() == view.begin());
+        ITERATORS_CHECK(view.begin() == container.begin());
+        ITERATORS_CHECK(container.begin() != view.end());
+        ITERATORS_CHECK(view.end() != container.begin());
+        ITERATORS_CHECK(container.end() == container.cend());
+        ITERATORS_CHECK(container.cbegin() == container.begin());
+
+        ConstIterator converted = container.begin();
+        ITERATORS_CHECK(*converted == 1);
+
+        Iterator found = std::find(container.begin(), container.end(), 2);
+        ITERATORS_CHECK(found != container.cend());
+        ITERATORS_CHECK(*found == 2);
+        ITERATORS_CHECK(std::find(container.cbegin(), container.cend(), 4) ==
+                        container.end());
+    }
+
+    template <typename Container>
+    void filled() {
+        Container container;
+        container.pushBack(1);
+        container.pushBack(2);
+        container.pushBack(3);
+        mixed(container);
+    }
+
+    struct Linked : own::IntrusiveHook<> {
+        explicit Linked(int value) : value(value) {}
+
+        inline bool operator==(int other) const { return this->value == other; }
+
+        int value;
+    };
+
+} // namespace
+
+// the const iterator of StaticList works in constant expressions too
+static_assert([] {
+    own::StaticList<int, 4> list = {1, 2, 3};
+    return std::find(list.begin(), list.end(), 3) != list.cend();
+}());
+
+int main() {
+    filled<own::List<int> >();
+    filled<own::MappedList<int> >();
+    filled<own::ReversibleList<int> >();
+    filled<own::RingBuffer<int> >();
+    filled<own::UnrolledList<int, 2> >();
+    filled<own::StaticList<int, 4> >();
+    filled<own::Vector<int> >();
+
+    {
+        Linked first(1);
+        Linked second(2);
+        Linked third(3);
+
+        own::IntrusiveList<Linked> linked;
+        linked.pushBack(&first);
+        linked.pushBack(&second);
+        linked.pushBack(&third);
+        mixed(linked);
+        linked.clear();
+    }
+
+    {
+        // the random access iterators also order and subtract across both kinds
+        own::RingBuffer<int> ring;
+        ring.pushBack(1);
+        ring.pushBack(2);
+
+        const own::RingBuffer<int>& view = ring;
+        ITERATORS_CHECK(ring.begin() < view.end());
+        ITERATORS_CHECK(view.begin() <= ring.begin());
+        ITERATORS_CHECK(ring.end() - view.begin() == 2);
+        ITERATORS_CHECK(view.end() - ring.begin() == 2);
+    }
+
+    if (failures == 0) {
+        std::printf("all iterator tests passed\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,333 @@
+/**
+ * Multi-producer and multi-consumer stress tests of the concurrent containers,
+ * meant to run under ThreadSanitizer:
+ *
+ *     cmake -S . -B build && cmake --build build
+ *     ctest --test-dir build --output-on-failure
+ *
+ * Every test checks conservation: each value handed to a container comes out
+ * exactly once, no matter how the threads interleave. The exit status is non
+ * zero if any check failed.
+ */
+
+#include "lock_free_stack.hpp"
+#include "mpmc_queue.hpp"
+#include "spsc_queue.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+#include "work_stealing_deque.hpp"
+
+// std::atomic
+#include <atomic>
+// std::printf
+#include <cstdio>
+// std::thread
+#include <thread>
+
+namespace {
+
+    using own::usize;
+
+    int failures = 0;
+
+#define STRESS_CHECK(condition)                                                        \
+    do {                                                                               \
+        if (!(condition)) {                                                            \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);  \
+            failures++;                                                                \
+        }                                                                              \
+    } while (0)
+
+    const usize THREADS = 4;
+    const usize VALUES = 20000;
+
+    /**
+     * @brief Counts how many times every value in [0, len) was taken out.
+     */
+    class Tally {
+      public:
+        explicit Tally(usize len) : counts(new std::atomic<unsigned>[len]), len(len) {
+            for (usize i = 0; i < len; i++) {
+                this->counts[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        ~Tally() { delete[] this->counts; }
+
+        inline void take(usize value) {
+            if (value < this->len) {
+                this->counts[value].fetch_add(1, std::memory_order_relaxed);
+            } else {
+                this->outOfRange.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Checks that every value was taken exactly once.
+         */
+        bool exact() const {
+            if (this->outOfRange.load() != 0) {
+                return false;
+            }
+            for (usize i = 0; i < this->len; i++) {
+                if (this->counts[i].load() != 1) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+      private:
+        Tally(const Tally&) = delete;
+        void operator=(const Tally&) = delete;
+
+        std::atomic<unsigned>* counts;
+        usize len;
+        std::atomic<usize> outOfRange{0};
+    };
+
+    /**
+     * @brief The owner pushes and pops at the bottom while thieves steal from the
+     * top, the small initial capacity makes the ring grow under the thieves.
+     */
+    void workStealingDeque() {
+        own::WorkStealingDeque<usize> deque(4);
+        Tally tally(VALUES);
+        std::atomic<bool> done(false);
+
+        own::Vector<std::thread> thieves;
+        for (usize t = 0; t < THREADS; t++) {
+            thieves.pushBack(std::thread([&deque, &tally, &done]() {
+                usize value;
+                for (;;) {
+                    if (deque.steal(value)) {
+                        tally.take(value);
+                    } else if (done.load(std::memory_order_acquire)) {
+                        if (!deque.steal(value)) {
+                            return;
+                        }
+                        tally.take(value);
+                    }
+                }
+            }));
+        }
+
+        usize value;
+        for (usize i = 0; i < VALUES; i++) {
+            deque.push(i);
+            if (i % 3 == 0 && deque.pop(value)) {
+                tally.take(value);
+            }
+        }
+        while (deque.pop(value)) {
+            tally.take(value);
+        }
+
+        done.store(true, std::memory_order_release);
+        for (usize t = 0; t < thieves.len(); t++) {
+            thieves[t].join();
+        }
+
+        STRESS_CHECK(deque.empty());
+        STRESS_CHECK(tally.exact());
+    }
+
+    /**
+     * @brief Producers and consumers mix single and batch operations, so batch
+     * claims race with single ones on both ends.
+     */
+    void mpmcQueue() {
+        own::MpmcQueue<usize> queue(64);
+        Tally tally(VALUES * THREADS);
+        std::atomic<usize> taken(0);
+
+        own::Vector<std::thread> threads;
+        for (usize t = 0; t < THREADS; t++) {
+            threads.pushBack(std::thread([&queue, t]() {
+                usize batch[8];
+                usize next = t * VALUES;
+                usize last = next + VALUES;
+
+                while (next < last) {
+                    if (next % 2 == 0) {
+                        queue.push(next++);
+                        continue;
+                    }
+
+                    usize count = 0;
+                    while (count < 8 && next + count < last) {
+                        batch[count] = next + count;
+                        count++;
+                    }
+                    usize pushed = queue.tryPushBatch(batch, count);
+                    next += pushed;
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }));
+
+            threads.pushBack(std::thread([&queue, &tally, &taken, t]() {
+                usize batch[8];
+                while (taken.load(std::memory_order_relaxed) < VALUES * THREADS) {
+                    usize count = t % 2 == 0 ? queue.tryPopBatch(batch, 8)
+                                             : usize(queue.tryPop(batch[0]));
+                    for (usize i = 0; i < count; i++) {
+                        tally.take(batch[i]);
+                    }
+                    if (count == 0) {
+                        std::this_thread::yield();
+                    }
+                    taken.fetch_add(count, std::memory_order_relaxed);
+                }
+            }));
+        }
+
+        for (usize t = 0; t < threads.len(); t++) {
+            threads[t].join();
+        }
+
+        STRESS_CHECK(queue.len() == 0);
+        STRESS_CHECK(tally.exact());
+    }
+
+    /**
+     * @brief One producer and one consumer, the values must also keep their order.
+     */
+    template <own::SpscWait Wait>
+    void spscQueue() {
+        own::SpscQueue<usize, Wait> queue(16);
+        usize outOfOrder = 0;
+
+        std::thread consumer([&queue, &outOfOrder]() {
+            for (usize i = 0; i < VALUES; i++) {
+                usize value;
+                if (i % 2 == 0) {
+                    value = queue.pop();
+                } else {
+                    while (!queue.tryPop(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+                outOfOrder += value != i;
+            }
+        });
+
+        for (usize i = 0; i < VALUES; i++) {
+            queue.push(i);
+        }
+        consumer.join();
+
+        STRESS_CHECK(outOfOrder == 0);
+        STRESS_CHECK(queue.len() == 0);
+    }
+
+    /**
+     * @brief Every thread pushes its own values and pops whatever is on top, the
+     * nodes are recycled constantly so ABA is exercised.
+     */
+    void lockFreeStack() {
+        own::LockFreeStack<usize> stack(8);
+        Tally tally(VALUES * THREADS);
+
+        own::Vector<std::thread> threads;
+        for (usize t = 0; t < THREADS; t++) {
+            threads.pushBack(std::thread([&stack, &tally, t]() {
+                usize value;
+                for (usize i = t * VALUES, last = i + VALUES; i < last; i++) {
+                    stack.emplace(i);
+                    if (i % 2 == 0 && stack.tryPop(value)) {
+                        tally.take(value);
+                    }
+                }
+                if (t == 0) {
+                    own::List<usize> rest = stack.popAll();
+                    while (!rest.empty()) {
+                        tally.take(rest.popFront());
+                    }
+                }
+            }));
+        }
+
+        for (usize t = 0; t < threads.len(); t++) {
+            threads[t].join();
+        }
+
+        usize value;
+        while (stack.tryPop(value)) {
+            tally.take(value);
+        }
+
+        STRESS_CHECK(stack.empty());
+        STRESS_CHECK(tally.exact());
+    }
+
+    /**
+     * @brief Tasks submitted from outside threads and from inside the workers, and
+     * segments that run nested forEachSegment calls.
+     */
+    void threadPool() {
+        own::ThreadPool pool(THREADS);
+
+        std::atomic<usize> ran(0);
+        own::Vector<std::thread> submitters;
+        for (usize t = 0; t < THREADS; t++) {
+            submitters.pushBack(std::thread([&pool, &ran]() {
+                for (usize i = 0; i < VALUES / 16; i++) {
+                    pool.submit([&pool, &ran]() {
+                        ran.fetch_add(1, std::memory_order_relaxed);
+                        pool.submit(
+                            [&ran]() { ran.fetch_add(1, std::memory_order_relaxed); });
+                    });
+                }
+            }));
+        }
+        for (usize t = 0; t < submitters.len(); t++) {
+            submitters[t].join();
+        }
+        pool.wait();
+
+        STRESS_CHECK(ran.load() == 2 * THREADS * (VALUES / 16));
+
+        own::Vector<usize> outer;
+        own::Vector<usize> inner;
+        for (usize i = 0; i < 64; i++) {
+            outer.pushBack(i);
+        }
+        for (usize i = 0; i < 256; i++) {
+            inner.pushBack(1);
+        }
+
+        std::atomic<usize> sum(0);
+        pool.forEachSegment(outer, 0, [&pool, &inner, &sum](auto first, auto last) {
+            for (; first != last; ++first) {
+                pool.forEachSegment(inner, 0, [&sum](auto from, auto to) {
+                    usize local = 0;
+                    for (; from != to; ++from) {
+                        local += *from;
+                    }
+                    sum.fetch_add(local, std::memory_order_relaxed);
+                });
+            }
+        });
+
+        STRESS_CHECK(sum.load() == outer.len() * inner.len());
+    }
+
+#undef STRESS_CHECK
+
+} // namespace
+
+int main() {
+    workStealingDeque();
+    mpmcQueue();
+    spscQueue<own::SPSC_SPIN>();
+    spscQueue<own::SPSC_BLOCK>();
+    lockFreeStack();
+    threadPool();
+
+    if (failures == 0) {
+        std::printf("all stress tests passed\n");
+    }
+    return failures == 0 ? 0 : 1;
+}